@@ -6,7 +6,29 @@
 #include <array>
 #include <algorithm>
 #include <random>
+#include <numeric>
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 #include "../include/static_sort.h"
+#include "../include/static_sort_permute.h"
+#include "../include/static_sort_lazy.h"
+#include "../include/static_sort_merge.h"
+#include "../include/static_sort_morton.h"
+#include "../include/static_sort_sparse.h"
+#include "../include/static_sort_stats.h"
+#include "../include/static_sort_quantiles.h"
+#include "../include/static_sort_memory.h"
+#include "../include/static_sort_indirect.h"
+#include "../include/static_sort_groupby.h"
+#include "../include/static_sort_codec.h"
+#include "../include/static_sort_topk.h"
+#include "../include/static_sort_queue.h"
+#include <queue>
 
 // Générateur de données aléatoires
 template <size_t N>
@@ -118,6 +140,894 @@ static void BM_StaticTimSort_Reversed(benchmark::State& state) {
     }
 }
 
+// Benchmark StaticSort - colonne d'une matrice row-major (gather/scatter)
+template <size_t N>
+static void BM_StaticSort_StridedColumn(benchmark::State& state) {
+    constexpr std::ptrdiff_t cols = 16;
+    StaticSort<N> sorter;
+    std::array<double, N * cols> base;
+    for (size_t i = 0; i < base.size(); ++i) base[i] = generate_random_array<1>()[0];
+    std::ptrdiff_t c = 0;
+    for (auto _ : state) {
+        auto matrix = base;
+        benchmark::DoNotOptimize(matrix);
+        sorter(&matrix[c], SortStride{cols});
+        benchmark::DoNotOptimize(matrix);
+        benchmark::ClobberMemory();
+        c = (c + 1) % cols;
+    }
+}
+
+// Référence : copie de la colonne dans un temporaire, tri puis recopie
+template <size_t N>
+static void BM_StaticSort_CopiedColumn(benchmark::State& state) {
+    constexpr std::ptrdiff_t cols = 16;
+    StaticSort<N> sorter;
+    std::array<double, N * cols> base;
+    for (size_t i = 0; i < base.size(); ++i) base[i] = generate_random_array<1>()[0];
+    std::ptrdiff_t c = 0;
+    for (auto _ : state) {
+        auto matrix = base;
+        benchmark::DoNotOptimize(matrix);
+        std::array<double, N> tmp;
+        for (size_t r = 0; r < N; ++r) tmp[r] = matrix[r * cols + c];
+        sorter(tmp);
+        for (size_t r = 0; r < N; ++r) matrix[r * cols + c] = tmp[r];
+        benchmark::DoNotOptimize(matrix);
+        benchmark::ClobberMemory();
+        c = (c + 1) % cols;
+    }
+}
+
+// Permutation appliquée à 20 colonnes de charge utile
+static std::vector<std::uint32_t> make_permutation(size_t rows) {
+    std::vector<std::uint32_t> perm(rows);
+    std::iota(perm.begin(), perm.end(), 0u);
+    std::shuffle(perm.begin(), perm.end(), std::mt19937(42));
+    return perm;
+}
+
+static void BM_PermutationApply_Naive(benchmark::State& state) {
+    const size_t rows = static_cast<size_t>(state.range(0));
+    const auto perm = make_permutation(rows);
+    std::vector<std::vector<float>> columns(20, std::vector<float>(rows, 1.f));
+    for (auto _ : state) {
+        for (auto& col : columns) {
+            std::vector<float> tmp(rows);
+            for (size_t i = 0; i < rows; ++i) tmp[i] = col[perm[i]];
+            col.swap(tmp);
+        }
+        benchmark::ClobberMemory();
+    }
+}
+
+static void BM_PermutationApply_Engine(benchmark::State& state) {
+    const size_t rows = static_cast<size_t>(state.range(0));
+    const auto perm = make_permutation(rows);
+    std::vector<std::vector<float>> columns(20, std::vector<float>(rows, 1.f));
+    std::vector<PermutationColumn> refs;
+    for (auto& col : columns) refs.emplace_back(std::span<float>(col));
+    WorkerPool pool;
+    PermutationApplier applier(rows, sizeof(float), &pool);
+    for (auto _ : state) {
+        applier.apply(perm, refs);
+        benchmark::ClobberMemory();
+    }
+}
+
+// Grandes plages : introsort à feuilles réseau et lecture de la première page
+static std::vector<double> make_random_vector(size_t n) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> dis(-1000., 1000.);
+    std::vector<double> v(n);
+    for (auto& x : v) x = dis(gen);
+    return v;
+}
+
+static void BM_StdSort_Large(benchmark::State& state) {
+    const auto base = make_random_vector(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto v = base;
+        std::sort(v.begin(), v.end());
+        benchmark::DoNotOptimize(v.data());
+    }
+}
+
+static void BM_HybridSort_Large(benchmark::State& state) {
+    const auto base = make_random_vector(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto v = base;
+        hybrid_sort(v);
+        benchmark::DoNotOptimize(v.data());
+    }
+}
+
+static void BM_PartialSort_FirstPage(benchmark::State& state) {
+    const auto base = make_random_vector(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto v = base;
+        std::partial_sort(v.begin(), v.begin() + 50, v.end());
+        benchmark::DoNotOptimize(v.data());
+    }
+}
+
+static void BM_LazySortedView_FirstPage(benchmark::State& state) {
+    const auto base = make_random_vector(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto v = base;
+        lazy_sorted_view view(v);
+        double sum = 0;
+        for (size_t i = 0; i < 50; ++i) sum += view[i];
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+// Fusion k-voies : runs aléatoires (range(1) = 0) ou chronologiques (range(1) = 1)
+static std::vector<std::vector<double>> make_runs(size_t k, size_t len, bool clustered) {
+    std::vector<std::vector<double>> runs(k);
+    for (size_t r = 0; r < k; ++r) {
+        runs[r] = make_random_vector(len);
+        if (clustered) for (size_t i = 0; i < len; ++i) runs[r][i] = double((i / 256) * k + r) * 1000.0 + runs[r][i];
+        std::sort(runs[r].begin(), runs[r].end());
+    }
+    return runs;
+}
+
+static void BM_KWayMerge_Heap(benchmark::State& state) {
+    const auto runs = make_runs(static_cast<size_t>(state.range(0)), 4096, state.range(1));
+    std::vector<double> out(runs.size() * 4096);
+    using Head = std::pair<const double*, const double*>;
+    auto later = [](const Head& a, const Head& b) { return *b.first < *a.first; };
+    for (auto _ : state) {
+        std::priority_queue<Head, std::vector<Head>, decltype(later)> heap(later);
+        for (auto& r : runs) heap.push({r.data(), r.data() + r.size()});
+        auto o = out.begin();
+        while (!heap.empty()) {
+            auto h = heap.top();
+            heap.pop();
+            *o++ = *h.first++;
+            if (h.first != h.second) heap.push(h);
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+}
+
+static void BM_KWayMerge_LoserTree(benchmark::State& state) {
+    const auto runs = make_runs(static_cast<size_t>(state.range(0)), 4096, state.range(1));
+    std::vector<std::span<const double>> spans(runs.begin(), runs.end());
+    std::vector<double> out(runs.size() * 4096);
+    LoserTreeMerger<double> merger(runs.size());
+    for (auto _ : state) {
+        merger.merge(spans, out.begin());
+        benchmark::DoNotOptimize(out.data());
+    }
+}
+
+// Ordre de Morton de points 3-D
+static std::vector<std::array<float, 3>> make_points(size_t n) {
+    const auto c = make_random_vector(3 * n);
+    std::vector<std::array<float, 3>> pts(n);
+    for (size_t i = 0; i < n; ++i) pts[i] = {float(c[3 * i]), float(c[3 * i + 1]), float(c[3 * i + 2])};
+    return pts;
+}
+
+static void BM_MortonOrder_StdSort(benchmark::State& state) {
+    const auto pts = make_points(static_cast<size_t>(state.range(0)));
+    std::vector<std::uint32_t> order(pts.size());
+    for (auto _ : state) {
+        const auto encode = MortonEncoder<3>::fit(pts);
+        std::vector<std::pair<std::uint32_t, std::uint32_t>> pairs(pts.size());
+        for (size_t i = 0; i < pts.size(); ++i) pairs[i] = {encode(pts[i]), static_cast<std::uint32_t>(i)};
+        std::sort(pairs.begin(), pairs.end());
+        for (size_t i = 0; i < pts.size(); ++i) order[i] = pairs[i].second;
+        benchmark::DoNotOptimize(order.data());
+    }
+}
+
+static void BM_MortonOrder_Engine(benchmark::State& state) {
+    const auto pts = make_points(static_cast<size_t>(state.range(0)));
+    std::vector<std::uint32_t> order(pts.size());
+    for (auto _ : state) {
+        morton_order(pts, order);
+        benchmark::DoNotOptimize(order.data());
+    }
+}
+
+// Même tri, tampons de travail pris dans une arène réutilisée (pages de 2 Mo)
+static void BM_MortonOrder_Arena(benchmark::State& state) {
+    const auto pts = make_points(static_cast<size_t>(state.range(0)));
+    std::vector<std::uint32_t> order(pts.size());
+    HugePageArena arena(3 * pts.size() * sizeof(std::uint64_t));
+    for (auto _ : state) {
+        morton_order(pts, order, &arena);
+        benchmark::DoNotOptimize(order.data());
+    }
+}
+
+// Assemblage COO -> CSR, ~8 non-zéros par ligne
+static void make_coo(size_t rows, std::vector<std::uint32_t>& r, std::vector<std::uint32_t>& c, std::vector<double>& v) {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<std::uint32_t> row(0, static_cast<std::uint32_t>(rows - 1)), col(0, 1u << 20);
+    r.resize(rows * 8); c.resize(r.size()); v.resize(r.size());
+    for (size_t i = 0; i < r.size(); ++i) { r[i] = row(gen); c[i] = col(gen); v[i] = double(i); }
+}
+
+static void BM_CooToCsr_StdSort(benchmark::State& state) {
+    const size_t rows = static_cast<size_t>(state.range(0));
+    std::vector<std::uint32_t> r, c;
+    std::vector<double> v;
+    make_coo(rows, r, c, v);
+    for (auto _ : state) {
+        // Référence : tri par ligne des paires (col, valeur) avec std::sort
+        std::vector<std::uint32_t> row_ptr(rows + 1, 0);
+        for (auto x : r) ++row_ptr[x + 1];
+        for (size_t i = 0; i < rows; ++i) row_ptr[i + 1] += row_ptr[i];
+        std::vector<std::uint32_t> pos(row_ptr.begin(), row_ptr.end() - 1);
+        std::vector<std::pair<std::uint32_t, double>> entries(r.size());
+        for (size_t i = 0; i < r.size(); ++i) entries[pos[r[i]]++] = {c[i], v[i]};
+        for (size_t i = 0; i < rows; ++i)
+            std::sort(entries.begin() + row_ptr[i], entries.begin() + row_ptr[i + 1],
+                      [](const auto& a, const auto& b) { return a.first < b.first; });
+        benchmark::DoNotOptimize(entries.data());
+    }
+}
+
+static void BM_CooToCsr_Engine(benchmark::State& state) {
+    const size_t rows = static_cast<size_t>(state.range(0));
+    std::vector<std::uint32_t> r, c;
+    std::vector<double> v;
+    make_coo(rows, r, c, v);
+    for (auto _ : state) {
+        auto m = coo_to_csr<double>(rows, 1u << 20, r, c, v);
+        benchmark::DoNotOptimize(m.values.data());
+    }
+}
+
+// Tri par lots de tableaux dispersés (pointeurs), comme après coalescence de petites requêtes
+template <size_t N>
+static void make_scattered_arrays(std::vector<float>& data, std::vector<float*>& rows) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dis(-1000.f, 1000.f);
+    data.resize(1024 * N);
+    for (auto& x : data) x = dis(gen);
+    rows.clear();
+    for (size_t j = 0; j < 1024; ++j) rows.push_back(data.data() + j * N);
+    std::shuffle(rows.begin(), rows.end(), gen);
+}
+
+template <size_t N>
+static void BM_StaticSort_ScatteredArrays(benchmark::State& state) {
+    std::vector<float> data;
+    std::vector<float*> rows;
+    make_scattered_arrays<N>(data, rows);
+    for (auto _ : state) {
+        // Réseau de tri sans données dépendantes : trier des tableaux déjà triés coûte autant
+        for (float* r : rows) StaticSort<N>()(r, r + N);
+        benchmark::DoNotOptimize(data.data());
+    }
+}
+
+template <size_t N>
+static void BM_StaticBatchSort_ScatteredArrays(benchmark::State& state) {
+    std::vector<float> data;
+    std::vector<float*> rows;
+    make_scattered_arrays<N>(data, rows);
+    for (auto _ : state) {
+        StaticBatchSort<N>()(rows.data(), rows.size());
+        benchmark::DoNotOptimize(data.data());
+    }
+}
+
+// Tableaux contigus (AoS) : std::vector<std::array<float, N>>
+template <size_t N>
+static void BM_StaticBatchSort_Windows(benchmark::State& state) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dis(-1000.f, 1000.f);
+    std::vector<std::array<float, N>> src(1024), data;
+    for (auto& a : src)
+        for (auto& x : a) x = dis(gen);
+    for (auto _ : state) {
+        data = src;
+        StaticBatchSort<N>()(std::span(data));
+        benchmark::DoNotOptimize(data.data());
+    }
+}
+
+template <size_t N>
+static void BM_Mad_TwoSorts(benchmark::State& state) {
+    std::vector<float> data;
+    std::vector<float*> rows;
+    make_scattered_arrays<N>(data, rows);
+    std::vector<float> out(1024);
+    for (auto _ : state) {
+        for (size_t j = 0; j < 1024; ++j) {
+            // Tri de la fenêtre pour la médiane, puis tri des écarts
+            std::array<float, N> w;
+            std::copy_n(data.data() + j * N, N, w.begin());
+            StaticSort<N>()(w);
+            const float med = w[N / 2];
+            for (auto& x : w) x = std::abs(x - med);
+            StaticSort<N>()(w);
+            out[j] = w[N / 2];
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+}
+
+template <size_t N>
+static void BM_Mad_GroupStats(benchmark::State& state) {
+    std::vector<float> data;
+    std::vector<float*> rows;
+    make_scattered_arrays<N>(data, rows);
+    std::vector<float> out(1024);
+    for (auto _ : state) {
+        StaticGroupStats<N>().mad(data.data(), 1024, out.data());
+        benchmark::DoNotOptimize(out.data());
+    }
+}
+
+// Latences par endpoint : longueurs de groupes log-normales (médiane ~50, queue jusqu'à ~20000)
+static void make_latency_groups(std::vector<float>& values, std::vector<size_t>& offsets) {
+    std::mt19937 gen(42);
+    std::lognormal_distribution<double> len(std::log(50.0), 1.5);
+    std::exponential_distribution<float> latency(0.01f);
+    offsets.assign(1, 0);
+    for (size_t g = 0; g < 2000; ++g) offsets.push_back(offsets.back() + std::min<size_t>(20000, size_t(len(gen))));
+    values.resize(offsets.back());
+    for (auto& x : values) x = latency(gen);
+}
+
+static void BM_GroupedQuantiles_StdSort(benchmark::State& state) {
+    std::vector<float> values, work;
+    std::vector<size_t> offsets;
+    make_latency_groups(values, offsets);
+    const double qs[] = {0.5, 0.9, 0.99};
+    std::vector<float> out((offsets.size() - 1) * 3);
+    for (auto _ : state) {
+        work = values;
+        for (size_t g = 0; g + 1 < offsets.size(); ++g) {
+            float* first = work.data() + offsets[g];
+            const size_t n = offsets[g + 1] - offsets[g];
+            std::sort(first, first + n);
+            for (size_t k = 0; k < 3 && n; ++k) {
+                const double h = qs[k] * double(n - 1);
+                const size_t lo = size_t(h);
+                out[g * 3 + k] = lo + 1 < n ? first[lo] + float(h - lo) * (first[lo + 1] - first[lo]) : first[lo];
+            }
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+}
+
+static void BM_GroupedQuantiles_Engine(benchmark::State& state) {
+    std::vector<float> values, work;
+    std::vector<size_t> offsets;
+    make_latency_groups(values, offsets);
+    const double qs[] = {0.5, 0.9, 0.99};
+    std::vector<float> out((offsets.size() - 1) * 3);
+    for (auto _ : state) {
+        work = values;
+        grouped_quantiles(std::span<float>(work), std::span<const size_t>(offsets), std::span<const double>(qs),
+                          std::span<float>(out));
+        benchmark::DoNotOptimize(out.data());
+    }
+}
+
+// Top 10 par groupe de longueur variable (mêmes groupes que les percentiles)
+static void BM_SegmentedTopK_PartialSortCopy(benchmark::State& state) {
+    std::vector<float> values;
+    std::vector<size_t> offsets;
+    make_latency_groups(values, offsets);
+    std::vector<float> out((offsets.size() - 1) * 10);
+    for (auto _ : state) {
+        for (size_t g = 0; g + 1 < offsets.size(); ++g)
+            std::partial_sort_copy(values.begin() + offsets[g], values.begin() + offsets[g + 1],
+                                   out.begin() + g * 10, out.begin() + (g + 1) * 10);
+        benchmark::DoNotOptimize(out.data());
+    }
+}
+
+static void BM_SegmentedTopK_Engine(benchmark::State& state) {
+    std::vector<float> values;
+    std::vector<size_t> offsets;
+    make_latency_groups(values, offsets);
+    std::vector<float> out((offsets.size() - 1) * 10);
+    for (auto _ : state) {
+        segmented_topk<10>(std::span<const float>(values), std::span<const size_t>(offsets), std::span<float>(out));
+        benchmark::DoNotOptimize(out.data());
+    }
+}
+
+// 1024 groupes de K listes triées de M éléments
+template <unsigned K, unsigned M>
+static std::vector<float> make_sorted_runs() {
+    std::vector<float> data;
+    std::vector<float*> rows;
+    make_scattered_arrays<K * M>(data, rows);
+    for (size_t r = 0; r < data.size() / M; ++r) std::sort(data.begin() + r * M, data.begin() + (r + 1) * M);
+    return data;
+}
+
+template <unsigned K, unsigned M>
+static void BM_MultiMerge_StaticSort(benchmark::State& state) {
+    const auto runs = make_sorted_runs<K, M>();
+    std::vector<float> data;
+    for (auto _ : state) {
+        data = runs;  // entrée restaurée : les comparateurs scalaires sont prédits sur des données déjà fusionnées
+        for (size_t g = 0; g < 1024; ++g) StaticSort<K * M>()(data.data() + g * K * M, data.data() + (g + 1) * K * M);
+        benchmark::DoNotOptimize(data.data());
+    }
+}
+
+template <unsigned K, unsigned M>
+static void BM_MultiMerge_Network(benchmark::State& state) {
+    const auto runs = make_sorted_runs<K, M>();
+    std::vector<float> data;
+    for (auto _ : state) {
+        data = runs;
+        for (size_t g = 0; g < 1024; ++g) StaticMultiMerge<K, M>()(data.data() + g * K * M, data.data() + (g + 1) * K * M);
+        benchmark::DoNotOptimize(data.data());
+    }
+}
+
+template <unsigned K, unsigned M>
+static void BM_MultiMerge_Batch(benchmark::State& state) {
+    const auto runs = make_sorted_runs<K, M>();
+    std::vector<float> data;
+    for (auto _ : state) {
+        data = runs;
+        StaticMultiMerge<K, M>().batch(data.data(), 1024);
+        benchmark::DoNotOptimize(data.data());
+    }
+}
+
+// Octets quantifiés : réseau forcé (comparateur explicite) contre sélection automatique (comptage dès N = 64)
+template <size_t N>
+static void BM_StaticSort_Bytes_Network(benchmark::State& state) {
+    std::mt19937 gen(42);
+    std::vector<std::uint8_t> src(1024 * N), data;
+    for (auto& x : src) x = std::uint8_t(gen());
+    for (auto _ : state) {
+        data = src;
+        for (size_t j = 0; j < 1024; ++j)
+            StaticSort<N>()(data.begin() + j * N, data.begin() + (j + 1) * N, detail::DefaultLess());
+        benchmark::DoNotOptimize(data.data());
+    }
+}
+
+template <size_t N>
+static void BM_StaticSort_Bytes_Auto(benchmark::State& state) {
+    std::mt19937 gen(42);
+    std::vector<std::uint8_t> src(1024 * N), data;
+    for (auto& x : src) x = std::uint8_t(gen());
+    for (auto _ : state) {
+        data = src;
+        for (size_t j = 0; j < 1024; ++j) StaticSort<N>()(data.begin() + j * N, data.begin() + (j + 1) * N);
+        benchmark::DoNotOptimize(data.data());
+    }
+}
+
+// Clés de L octets (UUID, empreintes) : memcmp dans un lambda contre l'échange sans branchement
+template <size_t L>
+static std::vector<std::array<std::array<std::byte, L>, 16>> make_byte_keys() {
+    std::mt19937 gen(42);
+    std::vector<std::array<std::array<std::byte, L>, 16>> keys(1024);
+    for (auto& a : keys)
+        for (auto& k : a)
+            for (auto& b : k) b = std::byte(gen() & 3);  // préfixes communs fréquents
+    return keys;
+}
+
+template <size_t L>
+static void BM_StaticSort_ByteKeys_Memcmp(benchmark::State& state) {
+    auto src = make_byte_keys<L>();
+    auto data = src;
+    for (auto _ : state) {
+        data = src;
+        for (auto& a : data)
+            StaticSort<16>()(a, [](const auto& x, const auto& y) { return std::memcmp(x.data(), y.data(), L) < 0; });
+        benchmark::DoNotOptimize(data.data());
+    }
+}
+
+template <size_t L>
+static void BM_StaticSort_ByteKeys(benchmark::State& state) {
+    auto src = make_byte_keys<L>();
+    auto data = src;
+    for (auto _ : state) {
+        data = src;
+        for (auto& a : data) StaticSort<16>()(a);
+        benchmark::DoNotOptimize(data.data());
+    }
+}
+
+// Tri stable d'enregistrements (clé, index), 1000 clés distinctes
+struct StableRecord {
+    std::uint32_t key;
+    std::uint32_t index;
+};
+
+static std::vector<StableRecord> make_stable_records(size_t n) {
+    std::mt19937 gen(42);
+    std::vector<StableRecord> v(n);
+    for (size_t i = 0; i < n; ++i) v[i] = {std::uint32_t(gen() % 1000), std::uint32_t(i)};
+    return v;
+}
+
+static constexpr auto by_record_key = [](const StableRecord& a, const StableRecord& b) { return a.key < b.key; };
+
+static void BM_StableSort_Std(benchmark::State& state) {
+    const auto src = make_stable_records(static_cast<size_t>(state.range(0)));
+    auto data = src;
+    for (auto _ : state) {
+        data = src;
+        std::stable_sort(data.begin(), data.end(), by_record_key);
+        benchmark::DoNotOptimize(data.data());
+    }
+}
+
+#if defined(__GLIBCXX__)
+// std::stable_sort sans mémoire disponible : repli interne de libstdc++
+static void BM_StableSort_StdNoBuffer(benchmark::State& state) {
+    const auto src = make_stable_records(static_cast<size_t>(state.range(0)));
+    auto data = src;
+    for (auto _ : state) {
+        data = src;
+        std::__inplace_stable_sort(data.begin(), data.end(), __gnu_cxx::__ops::__iter_comp_iter(by_record_key));
+        benchmark::DoNotOptimize(data.data());
+    }
+}
+#endif
+
+static void BM_StableSort_InPlace(benchmark::State& state) {
+    const auto src = make_stable_records(static_cast<size_t>(state.range(0)));
+    auto data = src;
+    for (auto _ : state) {
+        data = src;
+        inplace_stable_sort(data.begin(), data.end(), by_record_key);
+        benchmark::DoNotOptimize(data.data());
+    }
+}
+
+// Pointeurs vers des entités de 64 octets dispersées en mémoire, triés par un champ
+struct BenchEntity {
+    float key;
+    char payload[60];
+};
+
+static void make_entities(size_t n, std::vector<BenchEntity>& pool, std::vector<BenchEntity*>& ptrs) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dis(0.f, 1e6f);
+    pool.resize(n);
+    ptrs.resize(n);
+    for (size_t i = 0; i < n; ++i) {
+        pool[i].key = dis(gen);
+        ptrs[i] = &pool[i];
+    }
+    std::shuffle(ptrs.begin(), ptrs.end(), gen);
+}
+
+static void BM_SortPointers_StdSort(benchmark::State& state) {
+    std::vector<BenchEntity> pool;
+    std::vector<BenchEntity*> src, ptrs;
+    make_entities(static_cast<size_t>(state.range(0)), pool, src);
+    for (auto _ : state) {
+        ptrs = src;
+        std::sort(ptrs.begin(), ptrs.end(), [](const BenchEntity* a, const BenchEntity* b) { return a->key < b->key; });
+        benchmark::DoNotOptimize(ptrs.data());
+    }
+}
+
+static void BM_SortPointers_ByPointee(benchmark::State& state) {
+    std::vector<BenchEntity> pool;
+    std::vector<BenchEntity*> src, ptrs;
+    make_entities(static_cast<size_t>(state.range(0)), pool, src);
+    for (auto _ : state) {
+        ptrs = src;
+        sort_by_pointee(ptrs, &BenchEntity::key);
+        benchmark::DoNotOptimize(ptrs.data());
+    }
+}
+
+// Partition de tableaux de N flottants autour de la médiane (prédicat 50/50)
+template <size_t N>
+static std::vector<float> make_partition_data() {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dis(-1.f, 1.f);
+    std::vector<float> v(1024 * N);
+    for (auto& x : v) x = dis(gen);
+    return v;
+}
+
+template <size_t N>
+static void BM_Partition_Std(benchmark::State& state) {
+    const auto src = make_partition_data<N>();
+    auto data = src;
+    for (auto _ : state) {
+        data = src;
+        size_t total = 0;
+        for (size_t j = 0; j < 1024; ++j)
+            total += std::partition(data.begin() + j * N, data.begin() + (j + 1) * N, [](float x) { return x < 0.f; }) - data.begin();
+        benchmark::DoNotOptimize(total);
+    }
+}
+
+template <size_t N>
+static void BM_StaticPartition_Predicate(benchmark::State& state) {
+    const auto src = make_partition_data<N>();
+    auto data = src;
+    for (auto _ : state) {
+        data = src;
+        size_t total = 0;
+        for (size_t j = 0; j < 1024; ++j)
+            total += StaticPartition<N>()(data.begin() + j * N, data.begin() + (j + 1) * N, [](float x) { return x < 0.f; });
+        benchmark::DoNotOptimize(total);
+    }
+}
+
+template <size_t N>
+static void BM_StaticPartition_Pivot(benchmark::State& state) {
+    const auto src = make_partition_data<N>();
+    auto data = src;
+    for (auto _ : state) {
+        data = src;
+        size_t total = 0;
+        for (size_t j = 0; j < 1024; ++j)
+            total += StaticPartition<N>()(data.begin() + j * N, data.begin() + (j + 1) * N, 0.f);
+        benchmark::DoNotOptimize(total);
+    }
+}
+
+// Agrégation par clé : 1M lignes, state.range(0) clés distinctes
+static void make_groupby_columns(size_t cardinality, std::vector<std::int32_t>& keys, std::vector<float>& values) {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<std::int32_t> key(0, std::int32_t(cardinality) - 1);
+    std::uniform_real_distribution<float> val(0.f, 100.f);
+    keys.resize(1 << 20);
+    values.resize(1 << 20);
+    for (auto& k : keys) k = key(gen);
+    for (auto& v : values) v = val(gen);
+}
+
+static void BM_GroupBy_HashMap(benchmark::State& state) {
+    std::vector<std::int32_t> keys;
+    std::vector<float> values;
+    make_groupby_columns(size_t(state.range(0)), keys, values);
+    struct Agg { std::uint32_t count; float sum, min, max; };
+    for (auto _ : state) {
+        std::unordered_map<std::int32_t, Agg> groups;
+        for (size_t i = 0; i < keys.size(); ++i) {
+            auto [it, fresh] = groups.try_emplace(keys[i], Agg{0, 0.f, values[i], values[i]});
+            Agg& a = it->second;
+            ++a.count;
+            a.sum += values[i];
+            a.min = std::min(a.min, values[i]);
+            a.max = std::max(a.max, values[i]);
+        }
+        benchmark::DoNotOptimize(groups.size());
+    }
+}
+
+// Paires (clé, valeur) matérialisées, std::sort puis parcours des suites
+static void BM_GroupBy_StdSortPairs(benchmark::State& state) {
+    std::vector<std::int32_t> keys;
+    std::vector<float> values;
+    make_groupby_columns(size_t(state.range(0)), keys, values);
+    std::vector<std::pair<std::int32_t, float>> rows(keys.size());
+    std::vector<float> sums;
+    for (auto _ : state) {
+        for (size_t i = 0; i < keys.size(); ++i) rows[i] = {keys[i], values[i]};
+        std::sort(rows.begin(), rows.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+        sums.clear();
+        for (size_t i = 0; i < rows.size();) {
+            float sum = 0.f, lo = rows[i].second, hi = lo;
+            size_t j = i;
+            for (; j < rows.size() && rows[j].first == rows[i].first; ++j) {
+                sum += rows[j].second;
+                lo = std::min(lo, rows[j].second);
+                hi = std::max(hi, rows[j].second);
+            }
+            sums.push_back(sum + lo + hi);
+            i = j;
+        }
+        benchmark::DoNotOptimize(sums.data());
+    }
+}
+
+static void BM_GroupBy_Engine(benchmark::State& state) {
+    std::vector<std::int32_t> keys;
+    std::vector<float> values;
+    make_groupby_columns(size_t(state.range(0)), keys, values);
+    for (auto _ : state) {
+        auto groups = group_by(keys, values);
+        benchmark::DoNotOptimize(groups.sum.data());
+    }
+}
+
+// Tampons de tri pris dans une arène réutilisée d'un appel à l'autre
+static void BM_GroupBy_Arena(benchmark::State& state) {
+    std::vector<std::int32_t> keys;
+    std::vector<float> values;
+    make_groupby_columns(size_t(state.range(0)), keys, values);
+    HugePageArena arena(32 << 20);
+    for (auto _ : state) {
+        auto groups = group_by(keys, values, &arena);
+        benchmark::DoNotOptimize(groups.sum.data());
+    }
+}
+
+// Liste d'identifiants : 1M identifiants aléatoires parmi 16M, non triés
+static std::vector<std::uint32_t> make_posting_list() {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<std::uint32_t> id(0, (1u << 24) - 1);
+    std::vector<std::uint32_t> ids(1 << 20);
+    for (auto& x : ids) x = id(gen);
+    return ids;
+}
+
+// Référence : std::sort puis écarts en varint (7 bits par octet)
+static size_t varint_encode(const std::vector<std::uint32_t>& sorted, std::vector<std::uint8_t>& out) {
+    size_t w = 0;
+    std::uint32_t prev = 0;
+    for (std::uint32_t x : sorted) {
+        std::uint32_t gap = x - prev;
+        prev = x;
+        while (gap >= 0x80) { out[w++] = std::uint8_t(gap | 0x80); gap >>= 7; }
+        out[w++] = std::uint8_t(gap);
+    }
+    return w;
+}
+
+static void BM_SortEncode_StdSortVarint(benchmark::State& state) {
+    const auto src = make_posting_list();
+    std::vector<std::uint32_t> ids;
+    std::vector<std::uint8_t> out(src.size() * 5);
+    size_t bytes = 0;
+    for (auto _ : state) {
+        ids = src;
+        std::sort(ids.begin(), ids.end());
+        bytes = varint_encode(ids, out);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.counters["bits_per_id"] = 8.0 * double(bytes) / double(src.size());
+}
+
+static void BM_SortEncode_Packed(benchmark::State& state) {
+    const auto src = make_posting_list();
+    std::vector<std::uint32_t> ids;
+    std::vector<std::uint32_t> out(encoded_capacity(src.size()));
+    size_t words = 0;
+    for (auto _ : state) {
+        ids = src;
+        words = sort_encode(std::span(ids), std::span(out));
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.counters["bits_per_id"] = 32.0 * double(words) / double(src.size());
+}
+
+static void BM_Decode_Varint(benchmark::State& state) {
+    auto ids = make_posting_list();
+    std::sort(ids.begin(), ids.end());
+    std::vector<std::uint8_t> in(ids.size() * 5);
+    varint_encode(ids, in);
+    std::vector<std::uint32_t> out(ids.size());
+    for (auto _ : state) {
+        const std::uint8_t* r = in.data();
+        std::uint32_t prev = 0;
+        for (auto& x : out) {
+            std::uint32_t gap = 0;
+            for (unsigned shift = 0;; shift += 7) {
+                const std::uint8_t b = *r++;
+                gap |= std::uint32_t(b & 0x7F) << shift;
+                if (b < 0x80) break;
+            }
+            x = prev += gap;
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+}
+
+static void BM_Decode_Packed(benchmark::State& state) {
+    auto ids = make_posting_list();
+    const auto in = sort_encode(std::span(ids));
+    std::vector<std::uint32_t> out(ids.size());
+    for (auto _ : state) {
+        decode_sorted(in, std::span(out));
+        benchmark::DoNotOptimize(out.data());
+    }
+}
+
+// Top 10 des scores de 1M documents parcourus par state.range(0) threads
+struct BenchHit {
+    float score;
+    std::uint32_t id;
+};
+
+static std::vector<BenchHit> make_hits() {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dis(0.f, 1.f);
+    std::vector<BenchHit> hits(1 << 20);
+    for (std::uint32_t i = 0; i < hits.size(); ++i) hits[i] = {dis(gen), i};
+    return hits;
+}
+
+static void BM_TopK_MutexHeap(benchmark::State& state) {
+    const auto hits = make_hits();
+    const size_t threads = size_t(state.range(0));
+    auto worse = [](const BenchHit& a, const BenchHit& b) { return a.score > b.score; };
+    for (auto _ : state) {
+        std::mutex m;
+        std::priority_queue<BenchHit, std::vector<BenchHit>, decltype(worse)> heap(worse);
+        std::vector<std::thread> pool;
+        for (size_t t = 0; t < threads; ++t)
+            pool.emplace_back([&, t] {
+                for (size_t i = t; i < hits.size(); i += threads) {
+                    std::lock_guard lock(m);
+                    if (heap.size() < 10) heap.push(hits[i]);
+                    else if (hits[i].score > heap.top().score) { heap.pop(); heap.push(hits[i]); }
+                }
+            });
+        for (auto& th : pool) th.join();
+        benchmark::DoNotOptimize(heap.top());
+    }
+}
+
+static void BM_TopK_Concurrent(benchmark::State& state) {
+    const auto hits = make_hits();
+    const size_t threads = size_t(state.range(0));
+    auto better = [](const BenchHit& a, const BenchHit& b) { return a.score > b.score; };
+    for (auto _ : state) {
+        ConcurrentTopK<10, BenchHit, decltype(better)> topk(threads, better);
+        std::vector<std::thread> pool;
+        for (size_t t = 0; t < threads; ++t)
+            pool.emplace_back([&, t] {
+                auto producer = topk.producer();
+                for (size_t i = t; i < hits.size(); i += threads) producer.push(hits[i]);
+            });
+        for (auto& th : pool) th.join();
+        benchmark::DoNotOptimize(topk.top());
+    }
+}
+
+// Simulation d'événements : N événements en attente, chaque retrait en replanifie un plus tard
+static std::vector<float> make_event_delays() {
+    std::mt19937 gen(42);
+    std::exponential_distribution<float> delay(1.f);
+    std::vector<float> delays(1 << 12);
+    for (auto& d : delays) d = delay(gen);
+    return delays;
+}
+
+template <unsigned N>
+static void BM_EventQueue_StdPriorityQueue(benchmark::State& state) {
+    const auto delays = make_event_delays();
+    using Event = std::pair<float, std::uint32_t>;
+    for (auto _ : state) {
+        std::priority_queue<Event, std::vector<Event>, std::greater<>> q;
+        for (std::uint32_t i = 0; i < N; ++i) q.push({delays[i], i});
+        for (size_t i = N; i < delays.size(); ++i) {
+            const Event e = q.top();
+            q.pop();
+            q.push({e.first + delays[i], e.second});
+        }
+        benchmark::DoNotOptimize(q.top());
+    }
+}
+
+template <unsigned N, QueuePolicy Policy>
+static void BM_EventQueue_Static(benchmark::State& state) {
+    const auto delays = make_event_delays();
+    for (auto _ : state) {
+        StaticPriorityQueue<N, float, std::uint32_t, Policy> q;
+        for (std::uint32_t i = 0; i < N; ++i) q.push(delays[i], i);
+        for (size_t i = N; i < delays.size(); ++i) {
+            const auto [t, id] = q.pop_min();
+            q.push(t + delays[i], id);
+        }
+        benchmark::DoNotOptimize(q.top());
+    }
+}
+
 // Enregistrement des benchmarks pour N = 2 à 8 - Random data
 BENCHMARK(BM_StdSort_Random<2>);
 BENCHMARK(BM_StaticSort_Random<2>);
@@ -155,4 +1065,118 @@ BENCHMARK(BM_StaticTimSort_Reversed<16>);
 BENCHMARK(BM_StaticSort_Random<16>);
 BENCHMARK(BM_StaticTimSort_Random<16>);
 
+// Strided (colonnes de matrice)
+BENCHMARK(BM_StaticSort_StridedColumn<8>);
+BENCHMARK(BM_StaticSort_CopiedColumn<8>);
+BENCHMARK(BM_StaticSort_StridedColumn<16>);
+BENCHMARK(BM_StaticSort_CopiedColumn<16>);
+
+// Application d'une permutation à plusieurs colonnes
+BENCHMARK(BM_PermutationApply_Naive)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(BM_PermutationApply_Engine)->Arg(1 << 16)->Arg(1 << 20);
+
+// Plages de grande taille
+BENCHMARK(BM_StdSort_Large)->Arg(1000)->Arg(100000);
+BENCHMARK(BM_HybridSort_Large)->Arg(1000)->Arg(100000);
+BENCHMARK(BM_PartialSort_FirstPage)->Arg(100000);
+BENCHMARK(BM_LazySortedView_FirstPage)->Arg(100000);
+
+// Fusion k-voies
+BENCHMARK(BM_KWayMerge_Heap)->Args({64, 0})->Args({1024, 0})->Args({64, 1});
+BENCHMARK(BM_KWayMerge_LoserTree)->Args({64, 0})->Args({1024, 0})->Args({64, 1});
+
+// Ordre de Morton
+BENCHMARK(BM_MortonOrder_StdSort)->Arg(256)->Arg(100000);
+BENCHMARK(BM_MortonOrder_Engine)->Arg(256)->Arg(100000)->Arg(4000000);
+BENCHMARK(BM_MortonOrder_Arena)->Arg(256)->Arg(100000)->Arg(4000000);
+
+// Conversion COO -> CSR
+BENCHMARK(BM_CooToCsr_StdSort)->Arg(100000);
+BENCHMARK(BM_CooToCsr_Engine)->Arg(100000);
+
+// Tri par lots (voies SIMD)
+BENCHMARK(BM_StaticSort_ScatteredArrays<8>);
+BENCHMARK(BM_StaticBatchSort_ScatteredArrays<8>);
+BENCHMARK(BM_StaticSort_ScatteredArrays<16>);
+BENCHMARK(BM_StaticBatchSort_ScatteredArrays<16>);
+BENCHMARK(BM_StaticBatchSort_Windows<8>);
+BENCHMARK(BM_StaticBatchSort_Windows<16>);
+
+// Écart absolu médian sur 1024 fenêtres
+BENCHMARK(BM_Mad_TwoSorts<9>);
+BENCHMARK(BM_Mad_GroupStats<9>);
+BENCHMARK(BM_Mad_TwoSorts<25>);
+BENCHMARK(BM_Mad_GroupStats<25>);
+
+// Percentiles par groupe
+BENCHMARK(BM_GroupedQuantiles_StdSort);
+BENCHMARK(BM_GroupedQuantiles_Engine);
+
+// Top 10 par groupe
+BENCHMARK(BM_SegmentedTopK_PartialSortCopy);
+BENCHMARK(BM_SegmentedTopK_Engine);
+
+// Fusion de K listes triées de M éléments
+BENCHMARK(BM_MultiMerge_StaticSort<4, 4>);
+BENCHMARK(BM_MultiMerge_Network<4, 4>);
+BENCHMARK(BM_MultiMerge_Batch<4, 4>);
+BENCHMARK(BM_MultiMerge_StaticSort<8, 4>);
+BENCHMARK(BM_MultiMerge_Network<8, 4>);
+BENCHMARK(BM_MultiMerge_Batch<8, 4>);
+
+// Tri par comptage des petits domaines
+BENCHMARK(BM_StaticSort_Bytes_Network<32>);
+BENCHMARK(BM_StaticSort_Bytes_Auto<32>);
+BENCHMARK(BM_StaticSort_Bytes_Network<64>);
+BENCHMARK(BM_StaticSort_Bytes_Auto<64>);
+
+// Tri stable avec et sans tampon
+BENCHMARK(BM_StableSort_Std)->Arg(1 << 14)->Arg(1 << 20);
+#if defined(__GLIBCXX__)
+BENCHMARK(BM_StableSort_StdNoBuffer)->Arg(1 << 14)->Arg(1 << 20);
+#endif
+BENCHMARK(BM_StableSort_InPlace)->Arg(1 << 14)->Arg(1 << 20);
+
+// Tri de pointeurs par un champ de l'objet pointé
+BENCHMARK(BM_SortPointers_StdSort)->Arg(1 << 12)->Arg(1 << 20);
+BENCHMARK(BM_SortPointers_ByPointee)->Arg(1 << 12)->Arg(1 << 20);
+
+// Partition sans branchement
+BENCHMARK(BM_Partition_Std<16>);
+BENCHMARK(BM_StaticPartition_Predicate<16>);
+BENCHMARK(BM_StaticPartition_Pivot<16>);
+BENCHMARK(BM_Partition_Std<64>);
+BENCHMARK(BM_StaticPartition_Predicate<64>);
+BENCHMARK(BM_StaticPartition_Pivot<64>);
+
+// Agrégation par clé, peu ou beaucoup de clés distinctes
+BENCHMARK(BM_GroupBy_HashMap)->Arg(64)->Arg(1 << 16);
+BENCHMARK(BM_GroupBy_StdSortPairs)->Arg(64)->Arg(1 << 16);
+BENCHMARK(BM_GroupBy_Engine)->Arg(64)->Arg(1 << 16);
+BENCHMARK(BM_GroupBy_Arena)->Arg(64)->Arg(1 << 16);
+
+// Tri puis compression des écarts
+BENCHMARK(BM_SortEncode_StdSortVarint);
+BENCHMARK(BM_SortEncode_Packed);
+BENCHMARK(BM_Decode_Varint);
+BENCHMARK(BM_Decode_Packed);
+
+// Top K partagé entre threads
+BENCHMARK(BM_TopK_MutexHeap)->Arg(1)->Arg(8)->UseRealTime();
+BENCHMARK(BM_TopK_Concurrent)->Arg(1)->Arg(8)->UseRealTime();
+
+// File de priorité de capacité fixe
+BENCHMARK(BM_EventQueue_StdPriorityQueue<16>);
+BENCHMARK(BM_EventQueue_Static<16, QueuePolicy::Sorted>);
+BENCHMARK(BM_EventQueue_Static<16, QueuePolicy::Unsorted>);
+BENCHMARK(BM_EventQueue_StdPriorityQueue<64>);
+BENCHMARK(BM_EventQueue_Static<64, QueuePolicy::Sorted>);
+BENCHMARK(BM_EventQueue_Static<64, QueuePolicy::Unsorted>);
+
+// Clés d'octets dans l'ordre de memcmp
+BENCHMARK(BM_StaticSort_ByteKeys_Memcmp<16>);
+BENCHMARK(BM_StaticSort_ByteKeys<16>);
+BENCHMARK(BM_StaticSort_ByteKeys_Memcmp<32>);
+BENCHMARK(BM_StaticSort_ByteKeys<32>);
+
 BENCHMARK_MAIN();
@@ -2,10 +2,22 @@
 #define static_sort_h
 
 #include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <iterator>
+#include <limits>
 #include <ranges>
+#include <span>
 #include <concepts>
 #include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
 
 /*
  Adapted from the Bose-Nelson Sorting network code from:
@@ -52,6 +64,102 @@ namespace detail
   };
 }
 
+namespace detail
+{
+  /**
+   * Fixed-length byte strings ordered like memcmp (UUIDs, hash prefixes):
+   * std::array<std::byte, L> or std::array<unsigned char, L>, L a multiple of
+   * 8 up to 64. Their operator< compares byte by byte; swap_if_bytes()
+   * compares them as a whole, without branches.
+   */
+  template<class T>
+  struct byte_key : std::false_type {};
+
+  template<std::size_t L>
+  struct byte_key<std::array<std::byte, L>> : std::bool_constant<L % 8 == 0 && L >= 8 && L <= 64> {};
+
+  template<std::size_t L>
+  struct byte_key<std::array<unsigned char, L>> : std::bool_constant<L % 8 == 0 && L >= 8 && L <= 64> {};
+
+  template<class T>
+  concept ByteKey = byte_key<T>::value;
+
+  STATIC_SORT_FORCE_INLINE std::uint64_t load_big_endian(const unsigned char* p) noexcept
+  {
+    std::uint64_t w;
+    std::memcpy(&w, p, sizeof(w));
+    if constexpr (std::endian::native == std::endian::little)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+      w = __builtin_bswap64(w);
+#else
+      std::uint64_t r = 0;
+      for (int i = 0; i < 8; ++i) r = r << 8 | ((w >> (8 * i)) & 0xFF);
+      w = r;
+#endif
+    }
+    return w;
+  }
+
+  // Échange a et b si b < a dans l'ordre de memcmp
+  template<ByteKey T>
+  STATIC_SORT_FORCE_INLINE void swap_if_bytes(T& a, T& b) noexcept
+  {
+    constexpr std::size_t L = sizeof(T);
+    auto* pa = reinterpret_cast<unsigned char*>(a.data());
+    auto* pb = reinterpret_cast<unsigned char*>(b.data());
+#if defined(__SSE2__)
+    if constexpr (L == 16)
+    {
+      // Le premier octet différent décide : bit le plus bas de `ne`
+      const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pa));
+      const __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pb));
+      const unsigned ne = ~static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(x, y))) & 0xFFFFu;
+      const unsigned gt = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(x, y), x)));
+      const __m128i m = _mm_set1_epi8(static_cast<char>(0 - ((gt & ne & (0u - ne)) != 0)));
+      const __m128i d = _mm_and_si128(_mm_xor_si128(x, y), m);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(pa), _mm_xor_si128(x, d));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(pb), _mm_xor_si128(y, d));
+      return;
+    }
+#endif
+#if defined(__AVX2__)
+    if constexpr (L == 32)
+    {
+      const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pa));
+      const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pb));
+      const unsigned ne = ~static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)));
+      const unsigned gt = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_max_epu8(x, y), x)));
+      const __m256i m = _mm256_set1_epi8(static_cast<char>(0 - ((gt & ne & (0u - ne)) != 0)));
+      const __m256i d = _mm256_and_si256(_mm256_xor_si256(x, y), m);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(pa), _mm256_xor_si256(x, d));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(pb), _mm256_xor_si256(y, d));
+      return;
+    }
+#endif
+    // Mots de 64 bits gros-boutistes, comparés du dernier au premier
+    constexpr std::size_t W = L / 8;
+    bool gt = false;
+    for (std::size_t i = W; i-- > 0;)
+    {
+      const std::uint64_t wa = load_big_endian(pa + 8 * i), wb = load_big_endian(pb + 8 * i);
+      gt = (wa > wb) | ((wa == wb) & gt);
+    }
+    const std::uint64_t m = 0 - static_cast<std::uint64_t>(gt);
+    for (std::size_t i = 0; i < W; ++i)
+    {
+      std::uint64_t wa, wb;
+      std::memcpy(&wa, pa + 8 * i, 8);
+      std::memcpy(&wb, pb + 8 * i, 8);
+      const std::uint64_t d = (wa ^ wb) & m;
+      wa ^= d;
+      wb ^= d;
+      std::memcpy(pa + 8 * i, &wa, 8);
+      std::memcpy(pb + 8 * i, &wb, 8);
+    }
+  }
+}
+
 template<class T, class C>
 STATIC_SORT_FORCE_INLINE constexpr void swap_if(T& a, T& b, C c)
   noexcept(noexcept(c(a, b)) && std::is_nothrow_move_constructible_v<T>)
@@ -68,12 +176,226 @@ STATIC_SORT_FORCE_INLINE constexpr void swap_if(T& a, T& b, C c)
     a = should_swap ? temp_b : temp_a;
     b = should_swap ? temp_a : temp_b;
   }
+  else if constexpr (detail::ByteKey<T> && std::is_same_v<C, detail::DefaultLess>)
+  {
+    if (std::is_constant_evaluated())
+    {
+      if (c(b, a)) std::ranges::swap(a, b);
+    }
+    else detail::swap_if_bytes(a, b);
+  }
   else
   {
     if (c(b, a)) std::ranges::swap(a, b);
   }
 }
 
+/**
+ * Distance between two consecutive elements for the strided StaticSort
+ * overloads, counted in elements of the sorted type (e.g. the row length when
+ * sorting a column of a row-major matrix).
+ */
+struct SortStride
+{
+  std::ptrdiff_t elements;
+};
+
+template<unsigned NumElements>
+class StaticSort;
+
+/**
+ * Declares that the values to sort lie in [Lo, Hi]. Passed at the call site,
+ * StaticSort<N>()(a, SortValueRange<0, 15>()), or attached to a type through
+ * sort_value_range, it lets StaticSort count the values instead of comparing
+ * them. Values outside the range are undefined behaviour.
+ */
+template<auto Lo, auto Hi>
+struct SortValueRange
+{
+  static constexpr auto lo = Lo;
+  static constexpr auto hi = Hi;
+};
+
+/**
+ * Value range of an integer or enumeration type, used by StaticSort to pick a
+ * counting sort automatically when the domain is small next to N. Specialize
+ * it for your own types:
+ * `template<> struct sort_value_range<Bucket> : SortValueRange<Bucket::First, Bucket::Last> {};`
+ * The 8-bit integer types are predefined.
+ */
+template<class T>
+struct sort_value_range
+{
+};
+
+template<> struct sort_value_range<char> : SortValueRange<std::numeric_limits<char>::min(), std::numeric_limits<char>::max()> {};
+template<> struct sort_value_range<signed char> : SortValueRange<std::numeric_limits<signed char>::min(), std::numeric_limits<signed char>::max()> {};
+template<> struct sort_value_range<unsigned char> : SortValueRange<std::numeric_limits<unsigned char>::min(), std::numeric_limits<unsigned char>::max()> {};
+
+namespace detail
+{
+  // Types triables par comptage : entiers (sauf bool) et énumérations
+  template<class T>
+  concept CountingKey = (std::is_integral_v<T> && !std::is_same_v<T, bool>) || std::is_enum_v<T>;
+
+  template<class T>
+  struct counting_int { using type = T; };
+
+  template<class T>
+    requires std::is_enum_v<T>
+  struct counting_int<T> { using type = std::underlying_type_t<T>; };
+
+  template<class T>
+  using counting_int_t = typename counting_int<T>::type;
+
+  // Nombre de valeurs de [Lo, Hi] (arithmétique modulaire : valable pour les bornes signées)
+  template<class T, auto Lo, auto Hi>
+  inline constexpr std::uint64_t kRangeSize = static_cast<std::uint64_t>(static_cast<counting_int_t<T>>(Hi)) -
+                                              static_cast<std::uint64_t>(static_cast<counting_int_t<T>>(Lo)) + 1;
+
+  inline constexpr std::uint64_t kCountingMaxRange = 1 << 12;  // histogramme sur la pile
+  inline constexpr std::uint64_t kCountingCompareMax = 16;  // au-delà : histogramme scalaire
+
+  // Domaine déclaré au niveau du type, assez petit devant N pour que compter batte le réseau
+  // (jusqu'à 32 octets, le réseau en place est vectorisé par le compilateur et reste devant)
+  template<class T, unsigned N>
+  concept AutoCounting = CountingKey<T> && requires { sort_value_range<T>::lo; sort_value_range<T>::hi; } &&
+                         N >= 64 && kRangeSize<T, sort_value_range<T>::lo, sort_value_range<T>::hi> <= 4 * N;
+
+  /**
+   * Counting sort of data[0..N) for values in [Lo, Hi]. With AVX2 the
+   * histogram of a domain of at most 16 values is built by comparing 32
+   * bytes of keys with each value and counting the movemask bits, and the
+   * sorted output is written as runs of broadcast vectors. A bitmap of the
+   * values present limits the output pass to them, so a wide domain (all
+   * 256 bytes) costs little more than a narrow one.
+   */
+  template<unsigned N, auto Lo, auto Hi, CountingKey T>
+  void counting_sort(T* data) noexcept
+  {
+    using K = counting_int_t<T>;
+    constexpr std::uint64_t R = kRangeSize<T, Lo, Hi>;
+    static_assert(R <= kCountingMaxRange, "value range too wide for a counting sort");
+    constexpr K lo = static_cast<K>(Lo);
+    using Count = std::conditional_t<(N < 65536), std::uint16_t, std::uint32_t>;
+    std::array<Count, R> counts{};
+    unsigned i = 0;
+#if defined(__AVX2__)
+    if constexpr (R <= kCountingCompareMax)
+    {
+      constexpr unsigned W = 32 / sizeof(K);
+      for (; i + W <= N; i += W)
+      {
+        const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        for (std::uint64_t v = 0; v < R; ++v)
+        {
+          const K key = static_cast<K>(lo + static_cast<K>(v));
+          __m256i eq;
+          if constexpr (sizeof(K) == 1) eq = _mm256_cmpeq_epi8(x, _mm256_set1_epi8(static_cast<char>(key)));
+          else if constexpr (sizeof(K) == 2) eq = _mm256_cmpeq_epi16(x, _mm256_set1_epi16(static_cast<short>(key)));
+          else if constexpr (sizeof(K) == 4) eq = _mm256_cmpeq_epi32(x, _mm256_set1_epi32(static_cast<int>(key)));
+          else eq = _mm256_cmpeq_epi64(x, _mm256_set1_epi64x(static_cast<long long>(key)));
+          // Un bit de masque par octet : sizeof(K) bits par élément égal
+          counts[v] += static_cast<Count>(std::popcount(static_cast<unsigned>(_mm256_movemask_epi8(eq))) / sizeof(K));
+        }
+      }
+    }
+#endif
+    // Valeurs présentes, en bits : l'écriture ne parcourt que celles-ci
+    std::array<std::uint64_t, (R + 63) / 64> present{};
+    for (std::uint64_t v = 0; v < R && i > 0; ++v)
+      present[v / 64] |= std::uint64_t(counts[v] != 0) << (v % 64);
+    for (; i < N; ++i)
+    {
+      const auto v = static_cast<std::make_unsigned_t<K>>(static_cast<K>(data[i]) - lo);
+      ++counts[v];
+      present[v / 64] |= std::uint64_t(1) << (v % 64);
+    }
+
+#if defined(__AVX2__)
+    // Écriture par vecteurs diffusés dans un tampon à marge, les débordements étant recouverts ensuite
+    constexpr unsigned W = 32 / sizeof(K);
+    alignas(32) K out[N + W];
+    unsigned p = 0;
+    for (std::size_t w = 0; w < present.size(); ++w)
+      for (std::uint64_t bits = present[w]; bits; bits &= bits - 1)
+      {
+        const std::size_t v = w * 64 + static_cast<std::size_t>(std::countr_zero(bits));
+        const K key = static_cast<K>(lo + static_cast<K>(v));
+        __m256i b;
+        if constexpr (sizeof(K) == 1) b = _mm256_set1_epi8(static_cast<char>(key));
+        else if constexpr (sizeof(K) == 2) b = _mm256_set1_epi16(static_cast<short>(key));
+        else if constexpr (sizeof(K) == 4) b = _mm256_set1_epi32(static_cast<int>(key));
+        else b = _mm256_set1_epi64x(static_cast<long long>(key));
+        for (unsigned k = 0; k < counts[v]; k += W) _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + p + k), b);
+        p += counts[v];
+      }
+    std::memcpy(data, out, N * sizeof(T));
+#else
+    T* out = data;
+    for (std::size_t w = 0; w < present.size(); ++w)
+      for (std::uint64_t bits = present[w]; bits; bits &= bits - 1)
+      {
+        const std::size_t v = w * 64 + static_cast<std::size_t>(std::countr_zero(bits));
+        out = std::fill_n(out, counts[v], static_cast<T>(lo + static_cast<K>(v)));
+      }
+#endif
+  }
+
+  // Charge N éléments espacés de `stride` dans un tableau local
+  template<unsigned N, class T>
+  STATIC_SORT_FORCE_INLINE constexpr void strided_load(std::array<T, N>& out, const T* base, std::ptrdiff_t stride)
+    noexcept(std::is_nothrow_copy_assignable_v<T>)
+  {
+    unsigned i = 0;
+#if defined(__AVX2__)
+    if (!std::is_constant_evaluated())
+    {
+      // Gather AVX2 (8 voies) pour les types arithmétiques de 32 bits ; pour 64 bits,
+      // 4 voies seulement : les chargements scalaires sont aussi rapides
+      if constexpr (std::is_arithmetic_v<T> && sizeof(T) == 4 && N >= 8)
+      {
+        if (stride > -(std::numeric_limits<int>::max() / static_cast<std::ptrdiff_t>(N)) &&
+            stride < std::numeric_limits<int>::max() / static_cast<std::ptrdiff_t>(N))
+        {
+          const int s = static_cast<int>(stride);
+          const __m256i step = _mm256_mullo_epi32(_mm256_set1_epi32(s), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+          for (; i + 8 <= N; i += 8)
+          {
+            const __m256i idx = _mm256_add_epi32(step, _mm256_set1_epi32(static_cast<int>(i) * s));
+            const __m256i v = _mm256_i32gather_epi32(reinterpret_cast<const int*>(base), idx, 4);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out.data() + i), v);
+          }
+        }
+      }
+    }
+#endif
+    for (; i < N; ++i) out[i] = base[static_cast<std::ptrdiff_t>(i) * stride];
+  }
+
+  // Réécrit les N éléments triés à leur position d'origine (pas de scatter en AVX2)
+  template<unsigned N, class T>
+  STATIC_SORT_FORCE_INLINE constexpr void strided_store(std::array<T, N>& in, T* base, std::ptrdiff_t stride)
+    noexcept(std::is_nothrow_move_assignable_v<T>)
+  {
+    for (unsigned i = 0; i < N; ++i) base[static_cast<std::ptrdiff_t>(i) * stride] = std::move(in[i]);
+  }
+
+  // Gather -> réseau sur un tableau local -> scatter
+  template<unsigned N, class T, class C>
+  constexpr void sort_strided(T* base, std::ptrdiff_t stride, C c)
+  {
+    if constexpr (N > 1)
+    {
+      std::array<T, N> regs;
+      strided_load<N>(regs, base, stride);
+      if constexpr (std::is_same_v<C, DefaultLess>) StaticSort<N>()(regs);
+      else StaticSort<N>()(regs, c);
+      strided_store<N>(regs, base, stride);
+    }
+  }
+}
+
 template<unsigned NumElements>
 class StaticSort
 {
@@ -141,10 +463,56 @@ class StaticSort
     constexpr PS([[maybe_unused]] A& a, [[maybe_unused]] C c) {}
   };
 
+  // Tri par comptage si le domaine du type est déclaré et petit devant N
+  template<class T>
+  static constexpr bool counts_values = detail::AutoCounting<T, NumElements>;
+
 public:
   // Conteneur indexable par operator[]
   template<class Container>
-  constexpr void operator()(Container& arr) const { PS<Container, LT, 1, NumElements, (NumElements <= 1)> ps(arr, LT()); }
+  constexpr void operator()(Container& arr) const
+  {
+    using T = std::remove_cvref_t<decltype(arr[0])>;
+    if constexpr (std::ranges::contiguous_range<Container> && counts_values<T>)
+    {
+      if (!std::is_constant_evaluated())
+      {
+        detail::counting_sort<NumElements, sort_value_range<T>::lo, sort_value_range<T>::hi>(std::ranges::data(arr));
+        return;
+      }
+    }
+    PS<Container, LT, 1, NumElements, (NumElements <= 1)> ps(arr, LT());
+  }
+
+  // Domaine des valeurs déclaré à l'appel : tri par comptage
+  template<class Container, auto Lo, auto Hi>
+  constexpr void operator()(Container& arr, SortValueRange<Lo, Hi>) const
+  {
+    if constexpr (std::ranges::contiguous_range<Container>)
+    {
+      if (!std::is_constant_evaluated())
+      {
+        detail::counting_sort<NumElements, Lo, Hi>(std::ranges::data(arr));
+        return;
+      }
+    }
+    PS<Container, LT, 1, NumElements, (NumElements <= 1)> ps(arr, LT());
+  }
+
+  template<std::random_access_iterator Iterator, auto Lo, auto Hi>
+  constexpr void operator()(Iterator first, Iterator last, SortValueRange<Lo, Hi>) const
+  {
+    if (static_cast<unsigned>(last - first) != NumElements) return;
+    if constexpr (std::contiguous_iterator<Iterator>)
+    {
+      if (!std::is_constant_evaluated())
+      {
+        detail::counting_sort<NumElements, Lo, Hi>(std::to_address(first));
+        return;
+      }
+    }
+    (*this)(first, last);
+  }
 
   // Itérateurs aléatoires (suppose last - first valide)
   template<std::random_access_iterator Iterator>
@@ -152,6 +520,15 @@ public:
   {
     auto size = static_cast<unsigned>(last - first);
     if (size != NumElements) return;
+    if constexpr (std::contiguous_iterator<Iterator> && counts_values<std::iter_value_t<Iterator>>)
+    {
+      if (!std::is_constant_evaluated())
+      {
+        detail::counting_sort<NumElements, sort_value_range<std::iter_value_t<Iterator>>::lo,
+                              sort_value_range<std::iter_value_t<Iterator>>::hi>(std::to_address(first));
+        return;
+      }
+    }
     struct IteratorAdapter
     {
       Iterator base;
@@ -183,6 +560,13 @@ public:
 
   template<std::ranges::random_access_range R, class Compare>
   constexpr void operator()(R&& range, Compare lt) const { (*this)(std::ranges::begin(range), std::ranges::end(range), lt); }
+
+  // Pointeur de base + pas : colonne de matrice, champ d'un tableau de structures
+  template<class T>
+  constexpr void operator()(T* base, SortStride stride) const { detail::sort_strided<NumElements>(base, stride.elements, LT()); }
+
+  template<class T, class Compare>
+  constexpr void operator()(T* base, SortStride stride, Compare lt) const { detail::sort_strided<NumElements>(base, stride.elements, lt); }
 };
 
 template<>
@@ -216,6 +600,12 @@ public:
 
   template<std::ranges::random_access_range R, class Compare>
   constexpr void operator()(R&& range, Compare lt) const { (*this)(std::ranges::begin(range), std::ranges::end(range), lt); }
+
+  template<class T>
+  constexpr void operator()(T* base, SortStride stride) const { detail::sort_strided<2>(base, stride.elements, LT()); }
+
+  template<class T, class Compare>
+  constexpr void operator()(T* base, SortStride stride, Compare lt) const { detail::sort_strided<2>(base, stride.elements, lt); }
 };
 
 
@@ -260,6 +650,8 @@ public:
 
   template<std::ranges::random_access_range R> constexpr void operator()(R&& r) const { (*this)(std::ranges::begin(r), std::ranges::end(r)); }
   template<std::ranges::random_access_range R, class Compare> constexpr void operator()(R&& r, Compare c) const { (*this)(std::ranges::begin(r), std::ranges::end(r), c); }
+  template<class T> constexpr void operator()(T* base, SortStride s) const { detail::sort_strided<3>(base, s.elements, LT()); }
+  template<class T, class Compare> constexpr void operator()(T* base, SortStride s, Compare c) const { detail::sort_strided<3>(base, s.elements, c); }
 };
 
 // StaticSort<4> : 5 comparaisons (optimal)
@@ -309,6 +701,8 @@ public:
 
   template<std::ranges::random_access_range R> constexpr void operator()(R&& r) const { (*this)(std::ranges::begin(r), std::ranges::end(r)); }
   template<std::ranges::random_access_range R, class Compare> constexpr void operator()(R&& r, Compare c) const { (*this)(std::ranges::begin(r), std::ranges::end(r), c); }
+  template<class T> constexpr void operator()(T* base, SortStride s) const { detail::sort_strided<4>(base, s.elements, LT()); }
+  template<class T, class Compare> constexpr void operator()(T* base, SortStride s, Compare c) const { detail::sort_strided<4>(base, s.elements, c); }
 };
 
 // StaticSort<5> : 9 comparaisons (optimal)
@@ -374,6 +768,8 @@ public:
 
   template<std::ranges::random_access_range R> constexpr void operator()(R&& r) const { (*this)(std::ranges::begin(r), std::ranges::end(r)); }
   template<std::ranges::random_access_range R, class Compare> constexpr void operator()(R&& r, Compare c) const { (*this)(std::ranges::begin(r), std::ranges::end(r), c); }
+  template<class T> constexpr void operator()(T* base, SortStride s) const { detail::sort_strided<5>(base, s.elements, LT()); }
+  template<class T, class Compare> constexpr void operator()(T* base, SortStride s, Compare c) const { detail::sort_strided<5>(base, s.elements, c); }
 };
 
 // StaticSort<6> : 12 comparaisons (optimal)
@@ -451,6 +847,8 @@ public:
 
   template<std::ranges::random_access_range R> constexpr void operator()(R&& r) const { (*this)(std::ranges::begin(r), std::ranges::end(r)); }
   template<std::ranges::random_access_range R, class Compare> constexpr void operator()(R&& r, Compare c) const { (*this)(std::ranges::begin(r), std::ranges::end(r), c); }
+  template<class T> constexpr void operator()(T* base, SortStride s) const { detail::sort_strided<6>(base, s.elements, LT()); }
+  template<class T, class Compare> constexpr void operator()(T* base, SortStride s, Compare c) const { detail::sort_strided<6>(base, s.elements, c); }
 };
 
 // StaticSort<7> : 16 comparaisons (optimal)
@@ -544,6 +942,8 @@ public:
 
   template<std::ranges::random_access_range R> constexpr void operator()(R&& r) const { (*this)(std::ranges::begin(r), std::ranges::end(r)); }
   template<std::ranges::random_access_range R, class Compare> constexpr void operator()(R&& r, Compare c) const { (*this)(std::ranges::begin(r), std::ranges::end(r), c); }
+  template<class T> constexpr void operator()(T* base, SortStride s) const { detail::sort_strided<7>(base, s.elements, LT()); }
+  template<class T, class Compare> constexpr void operator()(T* base, SortStride s, Compare c) const { detail::sort_strided<7>(base, s.elements, c); }
 };
 
 // StaticSort<8> : 19 comparaisons (optimal)
@@ -649,6 +1049,8 @@ public:
 
   template<std::ranges::random_access_range R> constexpr void operator()(R&& r) const { (*this)(std::ranges::begin(r), std::ranges::end(r)); }
   template<std::ranges::random_access_range R, class Compare> constexpr void operator()(R&& r, Compare c) const { (*this)(std::ranges::begin(r), std::ranges::end(r), c); }
+  template<class T> constexpr void operator()(T* base, SortStride s) const { detail::sort_strided<8>(base, s.elements, LT()); }
+  template<class T, class Compare> constexpr void operator()(T* base, SortStride s, Compare c) const { detail::sort_strided<8>(base, s.elements, c); }
 };
 
 
@@ -803,5 +1205,790 @@ public:
 };
 
 
+namespace detail
+{
+  // Largeur d'un registre vectoriel : une voie par tableau trié
+#if defined(__AVX512F__)
+  inline constexpr std::size_t kBatchBytes = 64;
+#else
+  inline constexpr std::size_t kBatchBytes = 32;
+#endif
+
+  // Types triables par lots : arithmétiques scalaires d'au plus 8 octets
+  template<class T>
+  concept BatchElement = std::is_arithmetic_v<T> && !std::is_same_v<T, bool> && sizeof(T) <= 8;
+
+  /**
+   * One element of W independent arrays ("vertical" layout): StaticSort over
+   * an array of Lanes sorts W arrays at once, every comparator becoming a
+   * lane-wise min/max. With GCC and Clang the lanes are a vector type, so a
+   * comparator is one vector compare and two blends.
+   */
+  template<BatchElement T, std::size_t W>
+  struct Lanes
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    typedef T vector_type __attribute__((vector_size(sizeof(T) * W)));
+    vector_type v;
+#else
+    alignas(sizeof(T) * W <= 64 ? sizeof(T) * W : 64) T v[W];
+#endif
+  };
+
+  // Comparateur vertical : trouvé par ADL depuis les réseaux, plus spécialisé que swap_if(T&, T&, C)
+  template<class T, std::size_t W>
+  STATIC_SORT_FORCE_INLINE constexpr void swap_if(Lanes<T, W>& a, Lanes<T, W>& b, DefaultLess) noexcept
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    const auto x = a.v;
+    const auto y = b.v;
+    const auto lt = y < x;
+    a.v = lt ? y : x;
+    b.v = lt ? x : y;
+#else
+    for (std::size_t k = 0; k < W; ++k)
+    {
+      const T x = a.v[k];
+      const T y = b.v[k];
+      a.v[k] = y < x ? y : x;
+      b.v[k] = y < x ? x : y;
+    }
+#endif
+  }
+
+#if defined(__AVX2__)
+  // Transposition 8x8 de mots de 32 bits, en registres
+  STATIC_SORT_FORCE_INLINE void transpose_registers(__m256 (&r)[8]) noexcept
+  {
+    const __m256 t0 = _mm256_unpacklo_ps(r[0], r[1]), t1 = _mm256_unpackhi_ps(r[0], r[1]);
+    const __m256 t2 = _mm256_unpacklo_ps(r[2], r[3]), t3 = _mm256_unpackhi_ps(r[2], r[3]);
+    const __m256 t4 = _mm256_unpacklo_ps(r[4], r[5]), t5 = _mm256_unpackhi_ps(r[4], r[5]);
+    const __m256 t6 = _mm256_unpacklo_ps(r[6], r[7]), t7 = _mm256_unpackhi_ps(r[6], r[7]);
+    const __m256 u0 = _mm256_shuffle_ps(t0, t2, 0x44), u1 = _mm256_shuffle_ps(t0, t2, 0xEE);
+    const __m256 u2 = _mm256_shuffle_ps(t1, t3, 0x44), u3 = _mm256_shuffle_ps(t1, t3, 0xEE);
+    const __m256 u4 = _mm256_shuffle_ps(t4, t6, 0x44), u5 = _mm256_shuffle_ps(t4, t6, 0xEE);
+    const __m256 u6 = _mm256_shuffle_ps(t5, t7, 0x44), u7 = _mm256_shuffle_ps(t5, t7, 0xEE);
+    r[0] = _mm256_permute2f128_ps(u0, u4, 0x20);
+    r[1] = _mm256_permute2f128_ps(u1, u5, 0x20);
+    r[2] = _mm256_permute2f128_ps(u2, u6, 0x20);
+    r[3] = _mm256_permute2f128_ps(u3, u7, 0x20);
+    r[4] = _mm256_permute2f128_ps(u0, u4, 0x31);
+    r[5] = _mm256_permute2f128_ps(u1, u5, 0x31);
+    r[6] = _mm256_permute2f128_ps(u2, u6, 0x31);
+    r[7] = _mm256_permute2f128_ps(u3, u7, 0x31);
+  }
+
+  /**
+   * transposed_blocks() for 4-byte elements in 32-byte registers and N a
+   * multiple of 8: the 8 rows of a group are loaded as N / 8 tiles of 8 x 8
+   * elements, transposed in registers, and stored back the same way after the
+   * network, with no intermediate buffer.
+   */
+  template<unsigned N, class T, class Row, class Network>
+  void register_transposed_blocks(std::size_t full, Row row, Network network) noexcept
+  {
+    std::array<Lanes<T, 8>, N> block;
+    static_assert(sizeof(Lanes<T, 8>) == sizeof(__m256));
+    for (std::size_t j = 0; j < full; j += 8)
+    {
+      for (unsigned c = 0; c < N; c += 8)
+      {
+        __m256 r[8];  // float : simple conteneur de 32 bits
+        for (std::size_t k = 0; k < 8; ++k) r[k] = _mm256_loadu_ps(reinterpret_cast<const float*>(row(j + k) + c));
+        transpose_registers(r);
+        for (std::size_t k = 0; k < 8; ++k) std::memcpy(&block[c + k], &r[k], sizeof(__m256));
+      }
+      network(block);
+      for (unsigned c = 0; c < N; c += 8)
+      {
+        __m256 r[8];
+        for (std::size_t k = 0; k < 8; ++k) std::memcpy(&r[k], &block[c + k], sizeof(__m256));
+        transpose_registers(r);
+        for (std::size_t k = 0; k < 8; ++k) _mm256_storeu_ps(reinterpret_cast<float*>(row(j + k) + c), r[k]);
+      }
+    }
+  }
+#endif
+
+  /**
+   * Runs `network` on the arrays row(0) .. row(count) of N elements by
+   * complete groups of W: each group is transposed into an array of
+   * Lanes<T, W>, passed to network(block), and transposed back.
+   * Returns the number of arrays processed, count rounded down to W.
+   */
+  template<unsigned N, class T, std::size_t W, class Row, class Network>
+  std::size_t transposed_blocks(std::size_t count, Row row, Network network) noexcept
+  {
+    const std::size_t full = count - count % W;
+#if defined(__AVX2__)
+    // Les mots de 64 bits gardent le tampon : la transposition 4x4 en registres s'est révélée plus lente
+    if constexpr (sizeof(T) == 4 && W == 8 && N % 8 == 0)
+    {
+      register_transposed_blocks<N, T>(full, row, network);
+      return full;
+    }
+#endif
+    std::array<Lanes<T, W>, N> block{};
+    // Transposition par un tampon mémoire : des écritures scalaires plutôt que des insertions de voies
+    alignas(64) T buf[N][W];
+    static_assert(sizeof(block) == sizeof(buf));
+    for (std::size_t j = 0; j < full; j += W)
+    {
+      for (std::size_t k = 0; k < W; ++k)
+      {
+        const T* r = row(j + k);
+        for (unsigned i = 0; i < N; ++i) buf[i][k] = r[i];
+      }
+      std::memcpy(&block, buf, sizeof(buf));
+      network(block);
+      std::memcpy(buf, &block, sizeof(buf));
+      for (std::size_t k = 0; k < W; ++k)
+      {
+        T* r = row(j + k);
+        for (unsigned i = 0; i < N; ++i) r[i] = buf[i][k];
+      }
+    }
+    return full;
+  }
+}
+
+/**
+ * Sorts many independent arrays of NumElements arithmetic values at once.
+ * Arrays are taken by groups of W (one vector register of T), transposed so
+ * that element i of the W arrays shares a Lanes<T, W>, sorted by the
+ * StaticSort network with lane-wise min/max comparators, and transposed back.
+ * Arrays left over after the last full group are sorted one by one.
+ * \tparam NumElements  The number of elements in each array.
+ */
+template<unsigned NumElements>
+class StaticBatchSort
+{
+public:
+  template<class T>
+  static constexpr std::size_t lanes = std::max<std::size_t>(1, detail::kBatchBytes / sizeof(T));
+
+  // Trie `count` tableaux consécutifs : data[j * NumElements + i] est l'élément i du tableau j
+  template<detail::BatchElement T>
+  void operator()(T* data, std::size_t count) const noexcept
+  {
+    run<T>(count, [data](std::size_t j) { return data + j * NumElements; });
+  }
+
+  // Trie les tableaux désignés par `arrays[0..count)`, pas forcément contigus
+  template<detail::BatchElement T>
+  void operator()(T* const* arrays, std::size_t count) const noexcept
+  {
+    run<T>(count, [arrays](std::size_t j) { return arrays[j]; });
+  }
+
+  template<detail::BatchElement T>
+  void operator()(std::span<std::array<T, NumElements>> arrays) const noexcept
+  {
+    run<T>(arrays.size(), [&arrays](std::size_t j) { return arrays[j].data(); });
+  }
+
+private:
+  template<class T, class Row>
+  static void run(std::size_t count, Row row) noexcept
+  {
+    if constexpr (NumElements > 1)
+    {
+      std::size_t j = detail::transposed_blocks<NumElements, T, lanes<T>>(count, row, [](auto& block) {
+        StaticSort<NumElements>()(block);
+      });
+      for (; j < count; ++j)
+      {
+        T* r = row(j);
+        StaticSort<NumElements>()(r, r + NumElements);
+      }
+    }
+  }
+};
+
+namespace detail
+{
+  // Comparateur (i, j), indices à partir de 0 : min en i, max en j
+  struct NetworkPair
+  {
+    unsigned short i;
+    unsigned short j;
+  };
+
+  // Réseaux des spécialisations StaticSort<2..8>, dans le même ordre
+  inline constexpr NetworkPair kNetwork2[] = {{0, 1}};
+  inline constexpr NetworkPair kNetwork3[] = {{1, 2}, {0, 2}, {0, 1}};
+  inline constexpr NetworkPair kNetwork4[] = {{0, 1}, {2, 3}, {0, 2}, {1, 3}, {1, 2}};
+  inline constexpr NetworkPair kNetwork5[] = {{0, 1}, {3, 4}, {2, 4}, {2, 3}, {0, 3}, {0, 2}, {1, 4}, {1, 3}, {1, 2}};
+  inline constexpr NetworkPair kNetwork6[] = {{1, 2}, {4, 5}, {0, 2}, {3, 5}, {0, 1}, {3, 4},
+                                              {1, 4}, {0, 3}, {2, 5}, {1, 3}, {2, 4}, {2, 3}};
+  inline constexpr NetworkPair kNetwork7[] = {{1, 2}, {3, 4}, {5, 6}, {0, 2}, {3, 5}, {4, 6}, {0, 1}, {4, 5},
+                                              {2, 6}, {0, 4}, {1, 5}, {0, 3}, {2, 5}, {1, 3}, {2, 4}, {2, 3}};
+  inline constexpr NetworkPair kNetwork8[] = {{0, 1}, {2, 3}, {4, 5}, {6, 7}, {0, 2}, {1, 3}, {4, 6},
+                                              {5, 7}, {1, 2}, {5, 6}, {0, 4}, {3, 7}, {1, 5}, {2, 6},
+                                              {1, 4}, {3, 6}, {2, 4}, {3, 5}, {3, 4}};
+
+  // Bose-Nelson, même récursion que StaticSort::PS/PB (indices à partir de 1)
+  template<class Emit>
+  constexpr void bose_nelson_pb(Emit& emit, int i, int j, int x, int y)
+  {
+    if (x == 1 && y == 1) emit(i - 1, j - 1);
+    else if (x == 1 && y == 2) { emit(i - 1, j); emit(i - 1, j - 1); }
+    else if (x == 2 && y == 1) { emit(i - 1, j - 1); emit(i, j - 1); }
+    else
+    {
+      const int l = x >> 1;
+      const int m = (x & 1 ? y : y + 1) >> 1;
+      bose_nelson_pb(emit, i, j, l, m);
+      bose_nelson_pb(emit, i + l, j + m, x - l, y - m);
+      bose_nelson_pb(emit, i + l, j, x - l, m);
+    }
+  }
+
+  template<class Emit>
+  constexpr void bose_nelson_ps(Emit& emit, int i, int m)
+  {
+    if (m <= 1) return;
+    const int l = m >> 1;
+    bose_nelson_ps(emit, i, l);
+    bose_nelson_ps(emit, i + l, m - l);
+    bose_nelson_pb(emit, i, i + l, l, m - l);
+  }
+
+  template<unsigned N, class Emit>
+  constexpr void emit_sorting_network(Emit& emit)
+  {
+    auto table = [&](const auto& t) { for (const NetworkPair& p : t) emit(p.i, p.j); };
+    if constexpr (N == 2) table(kNetwork2);
+    else if constexpr (N == 3) table(kNetwork3);
+    else if constexpr (N == 4) table(kNetwork4);
+    else if constexpr (N == 5) table(kNetwork5);
+    else if constexpr (N == 6) table(kNetwork6);
+    else if constexpr (N == 7) table(kNetwork7);
+    else if constexpr (N == 8) table(kNetwork8);
+    else bose_nelson_ps(emit, 1, static_cast<int>(N));
+  }
+
+  // Tri pair-impair de Batcher sur la puissance de deux supérieure, fils >= N retirés (+inf implicite)
+  template<unsigned N, class Emit>
+  constexpr void emit_odd_even_merge_network(Emit& emit)
+  {
+    unsigned p2 = 1;
+    while (p2 < N) p2 *= 2;
+    for (unsigned p = 1; p < p2; p *= 2)
+      for (unsigned k = p; k >= 1; k /= 2)
+        for (unsigned j = k % p; j + k < p2; j += 2 * k)
+          for (unsigned i = 0; i < k && i + j + k < p2; ++i)
+            if ((i + j) / (2 * p) == (i + j + k) / (2 * p) && i + j + k < N) emit(static_cast<int>(i + j), static_cast<int>(i + j + k));
+  }
+
+  // Sorties d'un réseau dont la valeur est demandée (rang final)
+  template<unsigned N>
+  struct NetworkOutputs
+  {
+    std::array<bool, N> used{};
+  };
+
+  template<unsigned N, unsigned... K>
+  consteval NetworkOutputs<N> outputs_at()
+  {
+    static_assert(((K < N) && ...), "rank out of range");
+    NetworkOutputs<N> o;
+    ((o.used[K] = true), ...);
+    return o;
+  }
+
+  template<unsigned N>
+  consteval NetworkOutputs<N> outputs_below(unsigned k)
+  {
+    NetworkOutputs<N> o;
+    for (unsigned i = 0; i < k && i < N; ++i) o.used[i] = true;
+    return o;
+  }
+
+  /**
+   * Marks the comparators of `net` still needed for the requested outputs.
+   * Two passes:
+   * - forward, the known order relations between wires are tracked, starting
+   *   from inputs sorted by blocks of `run` elements; a comparator whose
+   *   wires are already in order is dropped, and so is one whose two wires
+   *   both hold values known to rank below, or both above, every requested
+   *   rank: by the 0-1 principle it is a no-op for the thresholds that
+   *   decide the requested outputs;
+   * - backward, a comparator is kept only if one of its wires still leads to
+   *   a requested output.
+   */
+  template<unsigned N, std::size_t S>
+  constexpr std::array<bool, S> prune_network(const std::array<NetworkPair, S>& net, const NetworkOutputs<N>& out,
+                                               unsigned run = 1)
+  {
+    // Ensembles de fils en bits : above[x] (valeurs connues supérieures à celle de x), below[x] (inférieures)
+    constexpr std::size_t kWords = (N + 63) / 64;
+    using Set = std::array<std::uint64_t, kWords>;
+    std::array<Set, N> above{}, below{};
+    auto has = [](const Set& s, unsigned x) { return (s[x / 64] >> (x % 64)) & 1; };
+    auto put = [](Set& s, unsigned x, bool b)
+    {
+      const std::uint64_t bit = std::uint64_t(1) << (x % 64);
+      s[x / 64] = b ? s[x / 64] | bit : s[x / 64] & ~bit;
+    };
+    auto count = [](const Set& s) { unsigned c = 0; for (std::uint64_t w : s) c += std::popcount(w); return c; };
+    auto for_each = [](const Set& s, auto f)
+    {
+      for (std::size_t w = 0; w < kWords; ++w)
+        for (std::uint64_t b = s[w]; b; b &= b - 1) f(static_cast<unsigned>(w * 64 + std::countr_zero(b)));
+    };
+
+    // Entrées triées par blocs de `run`
+    for (unsigned x = 0; x < N; ++x)
+      for (unsigned y = x + 1; y < N && y / run == x / run; ++y)
+      {
+        put(above[x], y, true);
+        put(below[y], x, true);
+      }
+
+    // Les deux fils du même côté de chaque rang demandé
+    auto same_side = [&](unsigned a, unsigned b)
+    {
+      const unsigned lo_a = count(below[a]), hi_a = N - 1 - count(above[a]);
+      const unsigned lo_b = count(below[b]), hi_b = N - 1 - count(above[b]);
+      for (unsigned r = 0; r < N; ++r)
+        if (out.used[r] && !((hi_a < r && hi_b < r) || (lo_a > r && lo_b > r))) return false;
+      return true;
+    };
+
+    std::array<bool, S> keep{};
+    for (std::size_t c = 0; c < S; ++c)
+    {
+      const unsigned i = net[c].i, j = net[c].j;
+      if (has(above[i], j) || same_side(i, j)) continue;  // déjà ordonnés, ou sans effet sur les sorties
+      keep[c] = true;
+      // min en i, max en j
+      Set below_min{}, above_min{}, below_max{}, above_max{};
+      for (std::size_t w = 0; w < kWords; ++w)
+      {
+        below_min[w] = below[i][w] & below[j][w];
+        above_min[w] = above[i][w] | above[j][w];
+        below_max[w] = below[i][w] | below[j][w];
+        above_max[w] = above[i][w] & above[j][w];
+      }
+      below[i] = below_min;
+      above[i] = above_min;
+      below[j] = below_max;
+      above[j] = above_max;
+      put(above[i], j, true);
+      put(below[j], i, true);
+      put(above[i], i, false);  // si j < i était connu
+      put(below[j], j, false);
+      // Relations symétriques, puis fermeture transitive à travers les deux fils modifiés
+      for (unsigned z = 0; z < N; ++z)
+      {
+        put(above[z], i, false);
+        put(below[z], i, false);
+        put(above[z], j, false);
+        put(below[z], j, false);
+      }
+      for (unsigned m : {i, j})
+      {
+        for_each(below[m], [&](unsigned z) { put(above[z], m, true); });
+        for_each(above[m], [&](unsigned z) { put(below[z], m, true); });
+      }
+      for (unsigned m : {i, j})
+      {
+        for_each(below[m], [&](unsigned z) { for (std::size_t w = 0; w < kWords; ++w) above[z][w] |= above[m][w]; });
+        for_each(above[m], [&](unsigned z) { for (std::size_t w = 0; w < kWords; ++w) below[z][w] |= below[m][w]; });
+      }
+    }
+
+    std::array<bool, N> needed = out.used;
+    for (std::size_t c = S; c-- > 0;)
+    {
+      if (!keep[c]) continue;
+      if (needed[net[c].i] || needed[net[c].j]) needed[net[c].i] = needed[net[c].j] = true;
+      else keep[c] = false;
+    }
+    return keep;
+  }
+
+  // Réseau de tri complet : 0 = celui de StaticSort<N>, 1 = Batcher
+  template<unsigned N, int Kind>
+  struct BaseNetwork
+  {
+    template<class Emit>
+    static constexpr void emit(Emit& e)
+    {
+      if constexpr (Kind == 0) emit_sorting_network<N>(e);
+      else emit_odd_even_merge_network<N>(e);
+    }
+
+    static constexpr std::size_t size = []
+    {
+      std::size_t n = 0;
+      auto count = [&](int, int) { ++n; };
+      emit(count);
+      return n;
+    }();
+
+    static constexpr auto pairs = []
+    {
+      std::array<NetworkPair, size> net{};
+      std::size_t n = 0;
+      auto push = [&](int i, int j) { net[n++] = {static_cast<unsigned short>(i), static_cast<unsigned short>(j)}; };
+      emit(push);
+      return net;
+    }();
+  };
+
+  template<unsigned N, int Kind, NetworkOutputs<N> Out, unsigned Run>
+  struct PrunedCandidate
+  {
+    using Base = BaseNetwork<N, Kind>;
+    static constexpr auto keep = prune_network<N>(Base::pairs, Out, Run);
+
+    static constexpr std::size_t size = []
+    {
+      std::size_t n = 0;
+      for (bool b : keep) n += b;
+      return n;
+    }();
+
+    static constexpr auto comparators = []
+    {
+      std::array<NetworkPair, size> net{};
+      std::size_t n = 0;
+      for (std::size_t c = 0; c < Base::size; ++c)
+        if (keep[c]) net[n++] = Base::pairs[c];
+      return net;
+    }();
+  };
+
+  /**
+   * Comparators needed for the requested outputs of inputs sorted by blocks
+   * of Run, in network order: the StaticSort<N> network and Batcher's
+   * odd-even merge network are both pruned with prune_network() and the
+   * shorter result is kept. Bose-Nelson is the better start for full and
+   * extreme-rank selections, Batcher's merges prune much further around the
+   * middle ranks (113 comparators instead of 154 for the median of 25) and
+   * reduce to merge networks on sorted runs.
+   */
+  template<unsigned N, NetworkOutputs<N> Out, unsigned Run = 1>
+  struct PrunedNetwork
+  {
+    using Best = std::conditional_t<(PrunedCandidate<N, 0, Out, Run>::size <= PrunedCandidate<N, 1, Out, Run>::size),
+                                    PrunedCandidate<N, 0, Out, Run>, PrunedCandidate<N, 1, Out, Run>>;
+
+    static constexpr std::size_t size = Best::size;
+    static constexpr auto comparators = Best::comparators;
+
+    template<class A, class C, std::size_t... I>
+    STATIC_SORT_FORCE_INLINE static constexpr void apply(A& a, [[maybe_unused]] C c, std::index_sequence<I...>)
+    {
+      using ::swap_if;  // le swap_if de Lanes reste trouvé par ADL
+      (swap_if(a[comparators[I].i], a[comparators[I].j], c), ...);
+    }
+
+    template<class A, class C>
+    STATIC_SORT_FORCE_INLINE static constexpr void run(A& a, C c)
+    {
+      apply(a, c, std::make_index_sequence<size>());
+    }
+  };
+
+  // Interface commune de StaticSelect, StaticPartialSort et StaticMultiMerge (mêmes surcharges que StaticSort)
+  template<unsigned N, NetworkOutputs<N> Out, unsigned Run = 1>
+  class SelectionNetwork
+  {
+  protected:
+    using LT = DefaultLess;
+    using Net = PrunedNetwork<N, Out, Run>;
+
+  public:
+    static constexpr std::size_t comparators = Net::size;
+
+    template<class Container>
+    constexpr void operator()(Container& arr) const { Net::run(arr, LT()); }
+
+    template<class Container, class Compare>
+      requires(!std::random_access_iterator<Container>)
+    constexpr void operator()(Container& arr, Compare lt) const { Net::run(arr, lt); }
+
+    template<std::random_access_iterator Iterator>
+    constexpr void operator()(Iterator first, [[maybe_unused]] Iterator last) const { Net::run(first, LT()); }
+
+    template<std::random_access_iterator Iterator, class Compare>
+    constexpr void operator()(Iterator first, [[maybe_unused]] Iterator last, Compare lt) const { Net::run(first, lt); }
+  };
+}
+
+/**
+ * Selection network: after StaticSelect<N, K...>()(a), a[k] holds the element
+ * of rank k (the value a full sort would put there) for every requested k.
+ * The other positions hold the remaining elements in unspecified order.
+ * Built at compile time by pruning a full sorting network down to the
+ * comparators that can change a requested output (see PrunedNetwork).
+ */
+template<unsigned N, unsigned... K>
+class StaticSelect : public detail::SelectionNetwork<N, detail::outputs_at<N, K...>()>
+{
+};
+
+/**
+ * Partial sorting network: after StaticPartialSort<N, K>()(a), a[0..K) holds
+ * the K smallest elements in order, and a[K..N) the others in unspecified order.
+ */
+template<unsigned N, unsigned K>
+class StaticPartialSort : public detail::SelectionNetwork<N, detail::outputs_below<N>(K)>
+{
+};
+
+/**
+ * Merge network for K sorted runs of M elements stored one after the other:
+ * after StaticMultiMerge<K, M>()(a), a[0..K * M) is sorted. It keeps the
+ * comparators of a sorting network of K * M elements that can still act on
+ * inputs sorted by blocks of M, so no work is spent on the order the runs
+ * already have: 43 comparators instead of 65 for 4 x 4, 151 instead of 211
+ * for 8 x 4. With Keep < K * M only a[0..Keep) is guaranteed (the merged top
+ * Keep) and the network shrinks further.
+ * \tparam K     The number of runs.
+ * \tparam M     The length of each run.
+ * \tparam Keep  The number of leading merged elements needed.
+ */
+template<unsigned K, unsigned M, unsigned Keep = K * M>
+  requires (K >= 1 && M >= 1 && Keep <= K * M)
+class StaticMultiMerge : public detail::SelectionNetwork<K * M, detail::outputs_below<K * M>(Keep), M>
+{
+  static constexpr unsigned N = K * M;
+  using Base = detail::SelectionNetwork<N, detail::outputs_below<N>(Keep), M>;
+  using typename Base::Net;
+
+public:
+  using Base::operator();
+
+  template<class T>
+  static constexpr std::size_t lanes = StaticBatchSort<N>::template lanes<T>;
+
+  // Fusionne les K tableaux triés de `runs` dans un seul tableau
+  template<class T, class Compare = detail::DefaultLess>
+  constexpr std::array<T, N> merge(const std::array<std::array<T, M>, K>& runs, Compare c = {}) const
+  {
+    std::array<T, N> out{};
+    for (unsigned r = 0; r < K; ++r)
+      for (unsigned i = 0; i < M; ++i) out[r * M + i] = runs[r][i];
+    Net::run(out, c);
+    return out;
+  }
+
+  /**
+   * Merges `count` groups at once: data[g * K * M + r * M + i] is element i of
+   * run r of group g. Groups are taken by W lanes like StaticBatchSort.
+   */
+  template<detail::BatchElement T>
+  void batch(T* data, std::size_t count) const noexcept
+  {
+    auto row = [data](std::size_t g) { return data + g * N; };
+    std::size_t g = detail::transposed_blocks<N, T, lanes<T>>(count, row, [](auto& block) {
+      Net::run(block, detail::DefaultLess());
+    });
+    for (; g < count; ++g)
+    {
+      T* r = row(g);
+      Net::run(r, detail::DefaultLess());
+    }
+  }
+};
+
+namespace detail
+{
+#if defined(__AVX2__)
+  // Indices (un octet par voie) des voies sélectionnées par un masque, tassées à gauche
+  template<unsigned Lanes, unsigned Dwords>
+  consteval std::array<std::uint64_t, (1u << Lanes)> left_pack_table()
+  {
+    std::array<std::uint64_t, (1u << Lanes)> t{};
+    for (unsigned m = 0; m < (1u << Lanes); ++m)
+    {
+      unsigned k = 0;
+      for (unsigned lane = 0; lane < Lanes; ++lane)
+        if (m >> lane & 1)
+          for (unsigned d = 0; d < Dwords; ++d, ++k) t[m] |= std::uint64_t(lane * Dwords + d) << (8 * k);
+    }
+    return t;
+  }
+
+  inline constexpr auto kLeftPack32 = left_pack_table<8, 1>();
+  inline constexpr auto kLeftPack64 = left_pack_table<4, 2>();
+
+  template<class T>
+  concept PackedPartitionElement = std::is_arithmetic_v<T> && !std::is_same_v<T, bool> && (sizeof(T) == 4 || sizeof(T) == 8);
+
+  // Masque des voies de v strictement inférieures au pivot (un bit par voie)
+  template<class T>
+  STATIC_SORT_FORCE_INLINE unsigned less_mask(__m256i v, __m256i p) noexcept
+  {
+    if constexpr (std::is_same_v<T, float>)
+      return static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(_mm256_castsi256_ps(v), _mm256_castsi256_ps(p), _CMP_LT_OQ)));
+    else if constexpr (std::is_same_v<T, double>)
+      return static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(_mm256_castsi256_pd(v), _mm256_castsi256_pd(p), _CMP_LT_OQ)));
+    else if constexpr (sizeof(T) == 4)
+    {
+      if constexpr (std::is_unsigned_v<T>)
+      {
+        // Comparaison signée après inversion du bit de signe
+        const __m256i s = _mm256_set1_epi32(std::numeric_limits<std::int32_t>::min());
+        v = _mm256_xor_si256(v, s);
+        p = _mm256_xor_si256(p, s);
+      }
+      return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(p, v))));
+    }
+    else
+    {
+      if constexpr (std::is_unsigned_v<T>)
+      {
+        const __m256i s = _mm256_set1_epi64x(std::numeric_limits<std::int64_t>::min());
+        v = _mm256_xor_si256(v, s);
+        p = _mm256_xor_si256(p, s);
+      }
+      return static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(p, v))));
+    }
+  }
+
+  /**
+   * Stable partition of data[0..N) around `pivot` by vector compares: each
+   * register of W elements is split by its less-than mask with two left-pack
+   * permutes. The lower part is stored in place (its cursor never passes the
+   * elements still to be read), the upper part into `high`; `low` and `hi`
+   * are the two cursors. Only the first N - N % W elements are processed.
+   */
+  template<unsigned N, class T>
+  STATIC_SORT_FORCE_INLINE void partition_vectors(T* data, T pivot, T* high, std::size_t& low, std::size_t& hi) noexcept
+  {
+    constexpr unsigned W = 32 / sizeof(T);
+    constexpr unsigned full = (1u << W) - 1;
+    __m256i p;
+    std::memcpy(&p, &pivot, sizeof(T));
+    if constexpr (sizeof(T) == 4) p = _mm256_broadcastd_epi32(_mm256_castsi256_si128(p));
+    else p = _mm256_broadcastq_epi64(_mm256_castsi256_si128(p));
+    for (std::size_t i = 0; i + W <= N; i += W)
+    {
+      const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+      const unsigned m = less_mask<T>(v, p);
+      std::uint64_t lo_lanes, hi_lanes;
+      if constexpr (sizeof(T) == 4) { lo_lanes = kLeftPack32[m]; hi_lanes = kLeftPack32[~m & full]; }
+      else { lo_lanes = kLeftPack64[m]; hi_lanes = kLeftPack64[~m & full]; }
+      const __m256i lo_idx = _mm256_cvtepu8_epi32(_mm_cvtsi64_si128(static_cast<long long>(lo_lanes)));
+      const __m256i hi_idx = _mm256_cvtepu8_epi32(_mm_cvtsi64_si128(static_cast<long long>(hi_lanes)));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + low), _mm256_permutevar8x32_epi32(v, lo_idx));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(high + hi), _mm256_permutevar8x32_epi32(v, hi_idx));
+      const unsigned n = static_cast<unsigned>(std::popcount(m));
+      low += n;
+      hi += W - n;
+    }
+  }
+#endif
+}
+
+/**
+ * Fixed-size partition: after `k = StaticPartition<N>()(a, pivot)`, a[0..k)
+ * holds the elements less than `pivot` and a[k..N) the others; with a
+ * predicate, a[0..k) holds the elements that satisfy it. Both parts keep the
+ * input order (stable partition), and nothing branches on the data.
+ *
+ * Every element is written to the lower cursor, in place, and to the upper
+ * cursor, into an N-element buffer copied back at the end; only the cursor
+ * of its side advances. With AVX2, contiguous arrays of 4- and 8-byte
+ * arithmetic values partitioned around a pivot take a whole register at a
+ * time, split by compare, movemask and left-pack permutes. Types that are
+ * not trivially copyable fall back to std::stable_partition.
+ * \tparam NumElements  The number of elements in the array or container.
+ */
+template<unsigned NumElements>
+class StaticPartition
+{
+  static constexpr unsigned N = NumElements;
+
+public:
+  template<class Container, class Pred>
+    requires std::predicate<Pred&, std::remove_reference_t<decltype(std::declval<Container&>()[0])>&>
+  constexpr std::size_t operator()(Container& arr, Pred pred) const
+  {
+    return run(std::begin(arr), pred);
+  }
+
+  template<class Container, class T>
+    requires (!std::predicate<T&, std::remove_reference_t<decltype(std::declval<Container&>()[0])>&>)
+  constexpr std::size_t operator()(Container& arr, const T& pivot) const
+  {
+    return run_pivot(std::begin(arr), pivot);
+  }
+
+  template<std::random_access_iterator Iterator, class Pred>
+    requires std::predicate<Pred&, std::iter_reference_t<Iterator>>
+  constexpr std::size_t operator()(Iterator first, [[maybe_unused]] Iterator last, Pred pred) const
+  {
+    return run(first, pred);
+  }
+
+  template<std::random_access_iterator Iterator, class T>
+    requires (!std::predicate<T&, std::iter_reference_t<Iterator>>)
+  constexpr std::size_t operator()(Iterator first, [[maybe_unused]] Iterator last, const T& pivot) const
+  {
+    return run_pivot(first, pivot);
+  }
+
+private:
+  template<class It, class T>
+  static constexpr std::size_t run_pivot(It first, const T& pivot)
+  {
+    using V = std::iter_value_t<It>;
+#if defined(__AVX2__)
+    if constexpr (std::contiguous_iterator<It> && detail::PackedPartitionElement<V> && std::is_arithmetic_v<T>)
+    {
+      // Pivot converti au type des éléments seulement s'il y est représenté exactement
+      if (!std::is_constant_evaluated() && static_cast<T>(static_cast<V>(pivot)) == pivot)
+      {
+        V* data = std::to_address(first);
+        V high[N + 32 / sizeof(V)];  // marge : les écritures vectorielles débordent du curseur
+        std::size_t low = 0, hi = 0;
+        detail::partition_vectors<N>(data, static_cast<V>(pivot), high, low, hi);
+        for (std::size_t i = N - N % (32 / sizeof(V)); i < N; ++i)
+        {
+          const V x = data[i];
+          const bool below = x < static_cast<V>(pivot);
+          data[low] = x;
+          high[hi] = x;
+          low += below;
+          hi += !below;
+        }
+        std::memcpy(data + low, high, hi * sizeof(V));
+        return low;
+      }
+    }
 #endif
+    return run(first, [&pivot](const V& x) { return x < pivot; });
+  }
 
+  template<class It, class Pred>
+  static constexpr std::size_t run(It first, Pred pred)
+  {
+    using V = std::iter_value_t<It>;
+    if constexpr (std::is_trivially_copyable_v<V> && std::is_default_constructible_v<V>)
+    {
+      V high[N];
+      std::size_t low = 0, hi = 0;
+      for (unsigned i = 0; i < N; ++i)
+      {
+        // Deux écritures, un seul curseur avance : pas de branche sur le prédicat
+        const V x = first[i];
+        const bool keep = static_cast<bool>(pred(x));
+        first[low] = x;
+        high[hi] = x;
+        low += keep;
+        hi += !keep;
+      }
+      std::copy(high, high + hi, first + low);
+      return low;
+    }
+    else return static_cast<std::size_t>(std::stable_partition(first, first + N, pred) - first);
+  }
+};
+
+#endif
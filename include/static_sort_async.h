@@ -0,0 +1,161 @@
+#ifndef static_sort_async_h
+#define static_sort_async_h
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory_resource>
+#include <mutex>
+#include <ranges>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "static_sort_engines.h"
+#include "static_sort_merge.h"
+
+/**
+ * Anything that can run a nullary task later, on some thread:
+ * `executor.execute(std::function<void()>)`.
+ */
+template<class E>
+concept SortExecutor = requires(E& e, std::function<void()> task) { e.execute(std::move(task)); };
+
+/**
+ * Awaitable returned by static_sort_async(). The range is cut into chunks
+ * sorted by hybrid_sort() as tasks on the executor; the task that finishes
+ * last merges the chunks with a LoserTreeMerger and resumes the awaiting
+ * coroutine on its own thread. No thread ever blocks on the sort.
+ *
+ * All the state lives in the awaitable, i.e. in the coroutine frame: the
+ * only allocations are the executor tasks and the merge buffers, taken from
+ * `mr`.
+ */
+template<class T, class Compare, SortExecutor Executor>
+class SortAwaitable
+{
+public:
+  SortAwaitable(std::span<T> data, Executor& ex, Compare c, std::size_t chunks,
+                std::pmr::memory_resource* mr = std::pmr::get_default_resource())
+    : data_(data), ex_(ex), cmp_(c), chunks_(std::clamp<std::size_t>(chunks, 1, data.size() / kMinChunk + 1)), mr_(mr) {}
+
+  SortAwaitable(const SortAwaitable&) = delete;
+  SortAwaitable& operator=(const SortAwaitable&) = delete;
+
+  // Une seule tranche : tri direct, sans suspension
+  bool await_ready()
+  {
+    if (chunks_ > 1) return false;
+    hybrid_sort(data_.begin(), data_.end(), cmp_);
+    return true;
+  }
+
+  bool await_suspend(std::coroutine_handle<> h)
+  {
+    continuation_ = h;
+    // +1 : la coroutine suspendue compte comme une tâche, pour ne pas reprendre avant la fin de la soumission
+    const std::size_t chunks = chunks_;
+    remaining_.store(chunks + 1, std::memory_order_relaxed);
+    for (std::size_t i = 0; i < chunks; ++i)
+    {
+      try { ex_.execute([this, i] { run_chunk(i); }); }
+      catch (...) { run_chunk(i); }  // tâche refusée par l'exécuteur : exécutée ici
+    }
+    // Dernier arrivé : la fusion a lieu ici et la coroutine continue sans suspension
+    if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+      finish();
+      return false;
+    }
+    return true;
+  }
+
+  void await_resume()
+  {
+    if (error_) std::rethrow_exception(error_);
+  }
+
+private:
+  static constexpr std::size_t kMinChunk = 1 << 14;
+
+  std::span<T> chunk(std::size_t i) const noexcept
+  {
+    const std::size_t n = data_.size();
+    return data_.subspan(i * n / chunks_, (i + 1) * n / chunks_ - i * n / chunks_);
+  }
+
+  void record(std::exception_ptr e)
+  {
+    std::lock_guard lock(error_mutex_);
+    if (!error_) error_ = e;
+  }
+
+  void run_chunk(std::size_t i) noexcept
+  {
+    try
+    {
+      const std::span<T> c = chunk(i);
+      hybrid_sort(c.begin(), c.end(), cmp_);
+    }
+    catch (...) { record(std::current_exception()); }
+    if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+      finish();
+      continuation_.resume();
+    }
+  }
+
+  // Fusion k-voies des tranches triées, puis recopie dans la plage
+  void finish() noexcept
+  {
+    if (error_) return;
+    try
+    {
+      std::pmr::vector<std::span<const T>> runs(chunks_, mr_);
+      for (std::size_t i = 0; i < chunks_; ++i) runs[i] = chunk(i);
+      std::pmr::vector<T> merged(mr_);
+      merged.reserve(data_.size());
+      LoserTreeMerger<T, Compare>(chunks_, cmp_, mr_).merge(runs, std::back_inserter(merged));
+      std::move(merged.begin(), merged.end(), data_.begin());
+    }
+    catch (...) { record(std::current_exception()); }
+  }
+
+  std::span<T> data_;
+  Executor& ex_;
+  Compare cmp_;
+  std::size_t chunks_;
+  std::pmr::memory_resource* mr_;
+  std::atomic<std::size_t> remaining_{0};
+  std::coroutine_handle<> continuation_;
+  std::mutex error_mutex_;
+  std::exception_ptr error_;
+};
+
+/**
+ * `co_await static_sort_async(range, executor)` sorts a contiguous range on
+ * `executor` and resumes the coroutine once it is sorted, on the thread that
+ * completed the last step (or inline, for ranges below two chunks of 16384
+ * elements). An exception from the comparator or from the merge buffer
+ * allocation is rethrown by the co_await.
+ * \param chunks  Number of chunk tasks, defaults to the hardware concurrency.
+ * \param mr      Source of the merge buffers, used by the last task only.
+ */
+template<std::ranges::contiguous_range R, SortExecutor Executor, class Compare = detail::DefaultLess>
+  requires std::ranges::sized_range<R>
+auto static_sort_async(R& range, Executor& executor, Compare c = {},
+                       std::size_t chunks = std::max(1u, std::thread::hardware_concurrency()),
+                       std::pmr::memory_resource* mr = std::pmr::get_default_resource())
+{
+  using T = std::remove_reference_t<std::ranges::range_reference_t<R>>;
+  return SortAwaitable<T, Compare, Executor>(std::span<T>(std::ranges::data(range), std::ranges::size(range)),
+                                             executor, c, chunks, mr);
+}
+
+#endif
@@ -0,0 +1,57 @@
+#ifndef static_sort_c_h
+#define static_sort_c_h
+
+/*
+ C interface of the precompiled kernels (static_sort_kernels library, built
+ with -DSTATIC_SORT_BUILD_KERNELS=ON). For every element type and every
+ N in 2..32:
+
+   void ss_sort_<type>_n<N>(type* data);                      sorts data[0..N)
+   void ss_sort_<type>_n<N>_batch(type* data, size_t count);  sorts count consecutive arrays of N
+
+ plus ss_sort_<type>(type* data, size_t n) for any length. Types are i32, i64,
+ u64, f32 and f64; floating-point arrays must not contain NaN.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+// X(tag, type) pour chaque type précompilé
+#define SS_KERNEL_TYPES(X) \
+  X(i32, int32_t)          \
+  X(i64, int64_t)          \
+  X(u64, uint64_t)         \
+  X(f32, float)            \
+  X(f64, double)
+
+// X(tag, type, N) pour N = 2 à 32
+#define SS_KERNEL_SIZES(X, tag, type)                                                                     \
+  X(tag, type, 2) X(tag, type, 3) X(tag, type, 4) X(tag, type, 5) X(tag, type, 6) X(tag, type, 7)         \
+  X(tag, type, 8) X(tag, type, 9) X(tag, type, 10) X(tag, type, 11) X(tag, type, 12) X(tag, type, 13)     \
+  X(tag, type, 14) X(tag, type, 15) X(tag, type, 16) X(tag, type, 17) X(tag, type, 18) X(tag, type, 19)   \
+  X(tag, type, 20) X(tag, type, 21) X(tag, type, 22) X(tag, type, 23) X(tag, type, 24) X(tag, type, 25)   \
+  X(tag, type, 26) X(tag, type, 27) X(tag, type, 28) X(tag, type, 29) X(tag, type, 30) X(tag, type, 31)   \
+  X(tag, type, 32)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SS_DECLARE_SIZE(tag, type, n)                 \
+  void ss_sort_##tag##_n##n(type* data);              \
+  void ss_sort_##tag##_n##n##_batch(type* data, size_t count);
+
+#define SS_DECLARE_TYPE(tag, type)                  \
+  SS_KERNEL_SIZES(SS_DECLARE_SIZE, tag, type)       \
+  void ss_sort_##tag(type* data, size_t n);
+
+SS_KERNEL_TYPES(SS_DECLARE_TYPE)
+
+#undef SS_DECLARE_TYPE
+#undef SS_DECLARE_SIZE
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,309 @@
+#ifndef static_sort_codec_h
+#define static_sort_codec_h
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <span>
+#include <utility>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "static_sort_engines.h"
+
+/*
+ Sorted id sets stored as bit-packed gaps. The stream is one word holding
+ the number of ids, then one block per 256 ids:
+   word 0      bit width B of the block's gaps (0 to 32)
+   word 1      first id of the block
+   8 * B words the 256 gaps, packed vertically: gap i goes to lane i % 8, and
+               each lane packs its 32 gaps on B bits, so that one vector of
+               8 words is packed or unpacked with shifts that apply to all
+               lanes at once.
+ The gaps of the last, incomplete block are padded with zeros.
+ */
+
+namespace detail
+{
+  inline constexpr std::size_t kPackLanes = 8;  // un registre AVX2 de mots de 32 bits
+  inline constexpr std::size_t kPackBlock = 32 * kPackLanes;
+
+  using PackVec = Lanes<std::uint32_t, kPackLanes>;
+
+  inline PackVec load_pack(const std::uint32_t* p) noexcept
+  {
+    PackVec v;
+    std::memcpy(&v.v, p, sizeof(v.v));
+    return v;
+  }
+
+  inline void store_pack(std::uint32_t* p, const PackVec& v) noexcept { std::memcpy(p, &v.v, sizeof(v.v)); }
+
+  // Opérations voie par voie sur les PackVec
+  inline PackVec bit_or(PackVec a, const PackVec& b) noexcept
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    a.v |= b.v;
+#else
+    for (std::size_t k = 0; k < kPackLanes; ++k) a.v[k] |= b.v[k];
+#endif
+    return a;
+  }
+
+  inline PackVec bit_and(PackVec a, std::uint32_t m) noexcept
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    a.v &= m;
+#else
+    for (std::size_t k = 0; k < kPackLanes; ++k) a.v[k] &= m;
+#endif
+    return a;
+  }
+
+  // Décalages de 0 à 31 bits
+  inline PackVec shift_left(PackVec a, unsigned s) noexcept
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    a.v <<= s;
+#else
+    for (std::size_t k = 0; k < kPackLanes; ++k) a.v[k] <<= s;
+#endif
+    return a;
+  }
+
+  inline PackVec shift_right(PackVec a, unsigned s) noexcept
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    a.v >>= s;
+#else
+    for (std::size_t k = 0; k < kPackLanes; ++k) a.v[k] >>= s;
+#endif
+    return a;
+  }
+
+  // 256 valeurs de B bits (1 à 32) -> 8 * B mots
+  template<unsigned B>
+  void pack_block(const std::uint32_t* in, std::uint32_t* out) noexcept
+  {
+    PackVec acc = load_pack(in);
+    unsigned filled = B;
+    for (std::size_t k = 1; k < 32; ++k)
+    {
+      const PackVec x = load_pack(in + k * kPackLanes);
+      if (filled == 32)
+      {
+        store_pack(out, acc);
+        out += kPackLanes;
+        acc = x;
+        filled = B;
+        continue;
+      }
+      acc = bit_or(acc, shift_left(x, filled));
+      filled += B;
+      if (filled > 32)
+      {
+        // La valeur chevauche deux mots : ses bits de poids fort ouvrent le suivant
+        store_pack(out, acc);
+        out += kPackLanes;
+        filled -= 32;
+        acc = shift_right(x, B - filled);
+      }
+    }
+    store_pack(out, acc);
+  }
+
+  template<unsigned B>
+  void unpack_block(const std::uint32_t* in, std::uint32_t* out) noexcept
+  {
+    constexpr std::uint32_t mask = B == 32 ? ~0u : (1u << B) - 1;
+    PackVec word = load_pack(in);
+    unsigned used = 0;
+    for (std::size_t k = 0; k < 32; ++k)
+    {
+      PackVec x;
+      if (used == 32)
+      {
+        in += kPackLanes;
+        word = load_pack(in);
+        used = 0;
+      }
+      if (used + B <= 32)
+      {
+        x = bit_and(shift_right(word, used), mask);
+        used += B;
+      }
+      else
+      {
+        in += kPackLanes;
+        const PackVec next = load_pack(in);
+        x = bit_and(bit_or(shift_right(word, used), shift_left(next, 32 - used)), mask);
+        used += B - 32;
+        word = next;
+      }
+      store_pack(out + k * kPackLanes, x);
+    }
+  }
+
+  // out[i] <- base + gaps[0] + ... + gaps[i], i < count
+  inline void prefix_sum(const std::uint32_t* gaps, std::uint32_t* out, std::size_t count, std::uint32_t base) noexcept
+  {
+    std::size_t i = 0;
+#if defined(__AVX2__)
+    // Balayage dans le registre : décalages de 1 et 2 mots par moitié, puis report de la moitié basse
+    __m256i carry = _mm256_set1_epi32(static_cast<int>(base));
+    const __m256i lane3 = _mm256_setr_epi32(0, 0, 0, 0, 3, 3, 3, 3);
+    const __m256i lane7 = _mm256_set1_epi32(7);
+    for (; i + kPackLanes <= count; i += kPackLanes)
+    {
+      __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(gaps + i));
+      x = _mm256_add_epi32(x, _mm256_slli_si256(x, 4));
+      x = _mm256_add_epi32(x, _mm256_slli_si256(x, 8));
+      x = _mm256_add_epi32(x, _mm256_blend_epi32(_mm256_setzero_si256(), _mm256_permutevar8x32_epi32(x, lane3), 0xF0));
+      x = _mm256_add_epi32(x, carry);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), x);
+      carry = _mm256_permutevar8x32_epi32(x, lane7);
+    }
+    if (i) base = out[i - 1];
+#endif
+    for (; i < count; ++i)
+    {
+      base += gaps[i];
+      out[i] = base;
+    }
+  }
+
+  using PackFn = void (*)(const std::uint32_t*, std::uint32_t*) noexcept;
+
+  // Un noyau par largeur, déroulé par le compilateur ; largeur 0 : rien à écrire ni à lire
+  template<std::size_t... B>
+  constexpr std::array<PackFn, 33> pack_kernels(std::index_sequence<B...>) noexcept
+  {
+    return {nullptr, &pack_block<B + 1>...};
+  }
+
+  template<std::size_t... B>
+  constexpr std::array<PackFn, 33> unpack_kernels(std::index_sequence<B...>) noexcept
+  {
+    return {nullptr, &unpack_block<B + 1>...};
+  }
+
+  inline constexpr std::array<PackFn, 33> kPack = pack_kernels(std::make_index_sequence<32>());
+  inline constexpr std::array<PackFn, 33> kUnpack = unpack_kernels(std::make_index_sequence<32>());
+}
+
+// Nombre de mots suffisant pour encoder n identifiants, quelle que soit leur répartition
+constexpr std::size_t encoded_capacity(std::size_t n) noexcept
+{
+  return 1 + (n + detail::kPackBlock - 1) / detail::kPackBlock * (2 + 32 * detail::kPackLanes);
+}
+
+/**
+ * Encodes ascending `ids` into `out` (see the stream format above) and
+ * returns the number of words written. Each block's gaps are computed into
+ * an L1-resident buffer, their bit width taken from the OR of the gaps, and
+ * the block packed by the kernel of that width: one pass over the ids.
+ * \param out  At least encoded_capacity(ids.size()) words.
+ */
+inline std::size_t encode_sorted(std::span<const std::uint32_t> ids, std::span<std::uint32_t> out)
+{
+  const std::size_t n = ids.size();
+  std::uint32_t* w = out.data();
+  *w++ = static_cast<std::uint32_t>(n);
+  alignas(32) std::uint32_t gaps[detail::kPackBlock];
+  for (std::size_t first = 0; first < n; first += detail::kPackBlock)
+  {
+    const std::size_t count = std::min(detail::kPackBlock, n - first);
+    const std::uint32_t* x = ids.data() + first;
+    gaps[0] = 0;
+    std::uint32_t any = 0;
+    for (std::size_t i = 1; i < count; ++i)
+    {
+      gaps[i] = x[i] - x[i - 1];
+      any |= gaps[i];
+    }
+    std::fill(gaps + count, gaps + detail::kPackBlock, 0u);
+    const unsigned bits = static_cast<unsigned>(std::bit_width(any));
+    *w++ = bits;
+    *w++ = x[0];
+    if (bits)
+    {
+      detail::kPack[bits](gaps, w);
+      w += bits * detail::kPackLanes;
+    }
+  }
+  return static_cast<std::size_t>(w - out.data());
+}
+
+// Nombre d'identifiants d'un flux
+inline std::size_t decoded_size(std::span<const std::uint32_t> in) noexcept { return in.empty() ? 0 : in[0]; }
+
+/**
+ * Decodes a stream written by encode_sorted() or sort_encode() into `out`
+ * (at least decoded_size(in) words): each block is unpacked by the kernel of
+ * its width, then its gaps are summed from the block's first id.
+ */
+inline void decode_sorted(std::span<const std::uint32_t> in, std::span<std::uint32_t> out)
+{
+  const std::size_t n = decoded_size(in);
+  const std::uint32_t* r = in.data() + 1;
+  alignas(32) std::uint32_t gaps[detail::kPackBlock];
+  for (std::size_t first = 0; first < n; first += detail::kPackBlock)
+  {
+    const std::size_t count = std::min(detail::kPackBlock, n - first);
+    const unsigned bits = r[0];
+    const std::uint32_t v = r[1];
+    r += 2;
+    std::uint32_t* x = out.data() + first;
+    if (bits == 0)
+    {
+      std::fill(x, x + count, v);
+      continue;
+    }
+    detail::kUnpack[bits](r, gaps);
+    r += bits * detail::kPackLanes;
+    detail::prefix_sum(gaps, x, count, v);
+  }
+}
+
+inline std::vector<std::uint32_t> decode_sorted(std::span<const std::uint32_t> in)
+{
+  std::vector<std::uint32_t> out(decoded_size(in));
+  decode_sorted(in, std::span<std::uint32_t>(out));
+  return out;
+}
+
+/**
+ * Sorts `ids` in place, then encodes them like encode_sorted() and returns
+ * the number of words written to `out`. Sets of fewer than 512 ids are
+ * sorted by introsort with sorting-network leaves (the network of the exact
+ * length up to 16 ids), larger ones by the radix sort, whose scratch buffer
+ * comes from `mr`.
+ */
+inline std::size_t sort_encode(std::span<std::uint32_t> ids, std::span<std::uint32_t> out,
+                               std::pmr::memory_resource* mr = std::pmr::get_default_resource())
+{
+  if (ids.size() < detail::kRadixThreshold) hybrid_sort(ids.begin(), ids.end());
+  else
+  {
+    std::pmr::vector<std::uint32_t> scratch(ids.size(), mr);
+    radix_sort(ids, std::span(scratch));
+  }
+  return encode_sorted(ids, out);
+}
+
+inline std::vector<std::uint32_t> sort_encode(std::span<std::uint32_t> ids,
+                                              std::pmr::memory_resource* mr = std::pmr::get_default_resource())
+{
+  std::vector<std::uint32_t> out(encoded_capacity(ids.size()));
+  out.resize(sort_encode(ids, std::span<std::uint32_t>(out), mr));
+  return out;
+}
+
+#endif
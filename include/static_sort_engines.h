@@ -0,0 +1,534 @@
+#ifndef static_sort_engines_h
+#define static_sort_engines_h
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "static_sort.h"
+
+/*
+ Dynamic-size engines built on the fixed-size networks: a length-dispatched
+ network sort for short ranges, an introsort whose leaves are sorting networks,
+ the matching introselect, an LSD radix sort for packed integer keys, and a
+ stable block-merge sort without allocation.
+ */
+
+namespace detail
+{
+  // Longueur en dessous de laquelle les partitions s'arrêtent au profit d'un réseau
+  inline constexpr std::size_t kNetworkLeaf = 16;
+
+  template<unsigned N, class It, class C>
+  STATIC_SORT_FORCE_INLINE constexpr void network_sort(It first, C& c)
+  {
+    // Sans comparateur explicite, StaticSort garde son swap branchless
+    if constexpr (std::is_same_v<std::remove_cvref_t<C>, DefaultLess>) StaticSort<N>()(first, first + N);
+    else StaticSort<N>()(first, first + N, c);
+  }
+
+  // Trie n <= kNetworkLeaf éléments avec le réseau de la bonne taille
+  template<class It, class C>
+  constexpr void sort_small_n(It first, std::size_t n, C& c)
+  {
+    switch (n)
+    {
+      case 2: network_sort<2>(first, c); break;
+      case 3: network_sort<3>(first, c); break;
+      case 4: network_sort<4>(first, c); break;
+      case 5: network_sort<5>(first, c); break;
+      case 6: network_sort<6>(first, c); break;
+      case 7: network_sort<7>(first, c); break;
+      case 8: network_sort<8>(first, c); break;
+      case 9: network_sort<9>(first, c); break;
+      case 10: network_sort<10>(first, c); break;
+      case 11: network_sort<11>(first, c); break;
+      case 12: network_sort<12>(first, c); break;
+      case 13: network_sort<13>(first, c); break;
+      case 14: network_sort<14>(first, c); break;
+      case 15: network_sort<15>(first, c); break;
+      case 16: network_sort<16>(first, c); break;
+      default: break;
+    }
+  }
+
+  // Médiane de trois placée en tête (comme std::sort)
+  template<class It, class C>
+  constexpr void move_median_to_first(It result, It a, It b, It c, C& cmp)
+  {
+    if (cmp(*a, *b))
+    {
+      if (cmp(*b, *c)) std::iter_swap(result, b);
+      else if (cmp(*a, *c)) std::iter_swap(result, c);
+      else std::iter_swap(result, a);
+    }
+    else if (cmp(*a, *c)) std::iter_swap(result, a);
+    else if (cmp(*b, *c)) std::iter_swap(result, c);
+    else std::iter_swap(result, b);
+  }
+
+  /**
+   * Hoare partition of [first, last) around a median-of-three pivot.
+   * Returns cut in (first, last) with [first, cut) <= pivot <= [cut, last).
+   */
+  template<class It, class C>
+  constexpr It partition_pivot(It first, It last, C& c)
+  {
+    It mid = first + (last - first) / 2;
+    move_median_to_first(first, first + 1, mid, last - 1, c);
+    It lo = first + 1;
+    It hi = last;
+    for (;;)
+    {
+      while (c(*lo, *first)) ++lo;
+      --hi;
+      while (c(*first, *hi)) --hi;
+      if (!(lo < hi)) return lo;
+      std::iter_swap(lo, hi);
+      ++lo;
+    }
+  }
+
+  template<class It, class C>
+  constexpr void hybrid_sort_loop(It first, It last, C& c, int depth)
+  {
+    while (static_cast<std::size_t>(last - first) > kNetworkLeaf)
+    {
+      if (depth-- == 0)
+      {
+        std::make_heap(first, last, c);
+        std::sort_heap(first, last, c);
+        return;
+      }
+      It cut = partition_pivot(first, last, c);
+      // Récursion sur la plus petite moitié : pile en O(log n)
+      if (cut - first < last - cut) { hybrid_sort_loop(first, cut, c, depth); first = cut; }
+      else { hybrid_sort_loop(cut, last, c, depth); last = cut; }
+    }
+    sort_small_n(first, static_cast<std::size_t>(last - first), c);
+  }
+
+  constexpr int introsort_depth(std::size_t n) noexcept { return 2 * std::bit_width(n); }
+}
+
+/**
+ * Sorts a range of at most 16 elements with the sorting network of its exact
+ * length, chosen at runtime. Longer ranges fall back to hybrid_sort().
+ */
+template<std::random_access_iterator It, class Compare = detail::DefaultLess>
+constexpr void sort_small(It first, It last, Compare c = {})
+{
+  const auto n = static_cast<std::size_t>(last - first);
+  if (n <= detail::kNetworkLeaf) detail::sort_small_n(first, n, c);
+  else detail::hybrid_sort_loop(first, last, c, detail::introsort_depth(n));
+}
+
+/**
+ * Introsort with sorting-network leaves: median-of-three quicksort down to
+ * 16 elements, finished by the network of the exact leaf length, with a
+ * heapsort fallback on degenerate partitions.
+ */
+template<std::random_access_iterator It, class Compare = detail::DefaultLess>
+constexpr void hybrid_sort(It first, It last, Compare c = {})
+{
+  detail::hybrid_sort_loop(first, last, c, detail::introsort_depth(static_cast<std::size_t>(last - first)));
+}
+
+template<std::ranges::random_access_range R, class Compare = detail::DefaultLess>
+constexpr void hybrid_sort(R&& range, Compare c = {})
+{
+  hybrid_sort(std::ranges::begin(range), std::ranges::end(range), c);
+}
+
+/**
+ * Introselect with sorting-network leaves: rearranges [first, last) like
+ * std::nth_element, so that *nth is the element that would be there if the
+ * range were sorted.
+ */
+template<std::random_access_iterator It, class Compare = detail::DefaultLess>
+constexpr void network_select(It first, It nth, It last, Compare c = {})
+{
+  if (nth == last) return;
+  int depth = detail::introsort_depth(static_cast<std::size_t>(last - first));
+  while (static_cast<std::size_t>(last - first) > detail::kNetworkLeaf)
+  {
+    if (depth-- == 0)
+    {
+      std::nth_element(first, nth, last, c);
+      return;
+    }
+    It cut = detail::partition_pivot(first, last, c);
+    if (cut <= nth) first = cut;
+    else last = cut;
+  }
+  detail::sort_small_n(first, static_cast<std::size_t>(last - first), c);
+}
+
+/**
+ * Stable LSD radix sort by the unsigned integer key `key(x)`, one byte per
+ * pass. The histograms of all bytes are built in a single pre-pass, and
+ * passes whose byte is the same for every element are skipped, so keys that
+ * use only their low bits (e.g. packed (key << 32 | index) values sorted by
+ * key >> 32) cost only the passes they need. The result ends in `data`.
+ * \param scratch  Buffer of at least data.size() elements.
+ */
+template<class T, class KeyFn = std::identity>
+  requires std::unsigned_integral<std::remove_cvref_t<std::invoke_result_t<KeyFn&, const T&>>>
+void radix_sort(std::span<T> data, std::span<T> scratch, KeyFn key = {})
+{
+  using K = std::remove_cvref_t<std::invoke_result_t<KeyFn&, const T&>>;
+  constexpr unsigned kBytes = sizeof(K);
+  const std::size_t n = data.size();
+  if (n <= detail::kNetworkLeaf)
+  {
+    auto by_key = [&](const T& a, const T& b) { return key(a) < key(b); };
+    // Stabilité : insertion sur les très petites entrées
+    for (std::size_t i = 1; i < n; ++i)
+      for (std::size_t j = i; j > 0 && by_key(data[j], data[j - 1]); --j) std::swap(data[j], data[j - 1]);
+    return;
+  }
+
+  std::array<std::array<std::size_t, 256>, kBytes> hist{};
+  for (const T& x : data)
+  {
+    const K k = key(x);
+    for (unsigned b = 0; b < kBytes; ++b) ++hist[b][(k >> (8 * b)) & 0xFF];
+  }
+
+  T* src = data.data();
+  T* dst = scratch.data();
+  for (unsigned b = 0; b < kBytes; ++b)
+  {
+    auto& h = hist[b];
+    if (h[(key(src[0]) >> (8 * b)) & 0xFF] == n) continue;  // octet constant
+    std::size_t sum = 0;
+    for (auto& c : h) { const std::size_t t = c; c = sum; sum += t; }
+    for (std::size_t i = 0; i < n; ++i) dst[h[(key(src[i]) >> (8 * b)) & 0xFF]++] = src[i];
+    std::swap(src, dst);
+  }
+  if (src != data.data()) std::copy(src, src + n, data.data());
+}
+
+namespace detail
+{
+  inline constexpr std::size_t kRadixThreshold = 512;
+
+  /**
+   * Maps an arithmetic key to an unsigned integer of the same order: sign bit
+   * flipped for signed integers, all bits flipped for negative floats and
+   * only the sign bit for positive ones. -0.0 sorts before +0.0; NaNs with
+   * the sign bit clear sort after +inf.
+   */
+  template<class K>
+  constexpr auto ordered_bits(K k) noexcept
+  {
+    if constexpr (std::is_floating_point_v<K>)
+    {
+      static_assert(sizeof(K) == 4 || sizeof(K) == 8, "float or double keys");
+      using U = std::conditional_t<sizeof(K) == 4, std::uint32_t, std::uint64_t>;
+      const U bits = std::bit_cast<U>(k);
+      constexpr U sign = U(1) << (8 * sizeof(K) - 1);
+      return bits ^ ((bits & sign) ? ~U(0) : sign);
+    }
+    else
+    {
+      using U = std::make_unsigned_t<K>;
+      if constexpr (std::is_signed_v<K>) return U(U(k) ^ (U(1) << (8 * sizeof(K) - 1)));
+      else return U(k);
+    }
+  }
+
+  template<class K>
+  using ordered_bits_t = decltype(ordered_bits(K{}));
+
+  /**
+   * order[i] <- index of the i-th smallest of `keys` (unsigned integers),
+   * equal keys in index order. The (key, index) pairs are packed into one
+   * integer for keys of at most 4 bytes, sorted by networks and introsort
+   * when short, by the radix sort on the key bytes only otherwise. Buffers
+   * come from `mr`.
+   */
+  template<class Key>
+  void sort_key_index(std::span<const Key> keys, std::span<std::uint32_t> order, std::pmr::memory_resource* mr)
+  {
+    const std::size_t n = keys.size();
+    if constexpr (sizeof(Key) <= 4)
+    {
+      // (clé << 32 | index) : un seul entier de 64 bits, les réseaux font des min/max
+      std::pmr::vector<std::uint64_t> packed(n, mr);
+      for (std::size_t i = 0; i < n; ++i) packed[i] = (std::uint64_t(keys[i]) << 32) | i;
+      if (n < kRadixThreshold) hybrid_sort(packed.begin(), packed.end());
+      else
+      {
+        // L'index est déjà croissant : le radix stable ne trie que les octets de clé
+        std::pmr::vector<std::uint64_t> scratch(n, mr);
+        radix_sort(std::span(packed), std::span(scratch), [](std::uint64_t v) { return Key(v >> 32); });
+      }
+      for (std::size_t i = 0; i < n; ++i) order[i] = static_cast<std::uint32_t>(packed[i]);
+    }
+    else
+    {
+      struct Pair
+      {
+        std::uint64_t key;
+        std::uint32_t index;
+        bool operator<(const Pair& o) const noexcept { return key < o.key || (key == o.key && index < o.index); }
+      };
+      std::pmr::vector<Pair> pairs(n, mr);
+      for (std::size_t i = 0; i < n; ++i) pairs[i] = {keys[i], static_cast<std::uint32_t>(i)};
+      if (n < kRadixThreshold) hybrid_sort(pairs.begin(), pairs.end());
+      else
+      {
+        std::pmr::vector<Pair> scratch(n, mr);
+        radix_sort(std::span(pairs), std::span(scratch), [](const Pair& p) { return p.key; });
+      }
+      for (std::size_t i = 0; i < n; ++i) order[i] = pairs[i].index;
+    }
+  }
+}
+
+namespace detail
+{
+  inline constexpr std::size_t kStableBlock = 16;  // longueur des blocs triés avant la première fusion
+  inline constexpr std::size_t kMergeBufferBytes = 4096;  // tampon de fusion sur la pile, de taille fixe
+
+  // Sans comparateur explicite, deux entiers égaux sont indiscernables : un réseau suffit.
+  // Pas les flottants : -0.0 et +0.0 sont égaux mais distincts
+  template<class T, class C>
+  inline constexpr bool kStabilityInvisible = std::integral<T> && std::is_same_v<std::remove_cvref_t<C>, DefaultLess>;
+
+  // Éléments de tampon : copiés octet à octet, jamais construits un à un
+  template<class T>
+  inline constexpr std::size_t kMergeBuffer =
+    std::is_trivially_copyable_v<T> && std::is_trivially_default_constructible_v<T>
+      ? std::max<std::size_t>(1, kMergeBufferBytes / sizeof(T)) : 0;
+
+  template<class It, class C>
+  void insertion_sort(It first, It last, C& c)
+  {
+    if (first == last) return;
+    for (It i = first + 1; i != last; ++i)
+    {
+      auto v = std::move(*i);
+      It j = i;
+      for (; j != first && c(v, *(j - 1)); --j) *j = std::move(*(j - 1));
+      *j = std::move(v);
+    }
+  }
+
+  // [first, middle) passe par le tampon, fusion vers l'avant ; à égalité la gauche sort d'abord
+  template<class It, class T, class C>
+  void merge_forward(It first, It middle, It last, T* buf, C& c)
+  {
+    const T* b = buf;
+    const T* be = std::copy(first, middle, buf);
+    It out = first;
+    It j = middle;
+    while (b != be && j != last)
+    {
+      // Sélection de la source par pointeur : cmov plutôt que branche imprévisible
+      const bool right = c(*j, *b);
+      *out = *(right ? std::addressof(*j) : b);
+      ++out;
+      j += right;
+      b += !right;
+    }
+    std::copy(b, be, out);
+  }
+
+  // [middle, last) passe par le tampon, fusion vers l'arrière ; à égalité la droite sort d'abord
+  template<class It, class T, class C>
+  void merge_backward(It first, It middle, It last, T* buf, C& c)
+  {
+    const T* b = buf;
+    const T* be = std::copy(middle, last, buf);
+    It out = last;
+    It i = middle;
+    while (b != be && i != first)
+    {
+      const bool left = c(be[-1], *(i - 1));
+      *--out = *(left ? std::addressof(*(i - 1)) : be - 1);
+      i -= left;
+      be -= !left;
+    }
+    std::copy(b, be, first);
+  }
+
+  /**
+   * Stable merge of [first, middle) and [middle, last) with at most `Cap`
+   * elements of extra storage: a linear merge through the buffer as soon as
+   * one side fits in it, otherwise the longer side is cut in half, its
+   * partner located by binary search, the two middle parts swapped by a
+   * rotation, and both halves merged in turn.
+   */
+  template<std::size_t Cap, class It, class T, class C>
+  void merge_inplace(It first, It middle, It last, T* buf, C& c)
+  {
+    for (;;)
+    {
+      const std::size_t len1 = static_cast<std::size_t>(middle - first);
+      const std::size_t len2 = static_cast<std::size_t>(last - middle);
+      if (len1 == 0 || len2 == 0 || !c(*middle, *(middle - 1))) return;  // déjà ordonnés
+      if constexpr (Cap > 0)
+      {
+        if (len1 <= Cap && len1 <= len2) { merge_forward(first, middle, last, buf, c); return; }
+        if (len2 <= Cap) { merge_backward(first, middle, last, buf, c); return; }
+        if (len1 <= Cap) { merge_forward(first, middle, last, buf, c); return; }
+      }
+      if (len1 + len2 == 2)
+      {
+        std::iter_swap(first, middle);
+        return;
+      }
+      It cut1, cut2;
+      if (len1 > len2)
+      {
+        cut1 = first + len1 / 2;
+        cut2 = std::lower_bound(middle, last, *cut1, c);
+      }
+      else
+      {
+        cut2 = middle + len2 / 2;
+        cut1 = std::upper_bound(first, middle, *cut2, c);
+      }
+      It mid = std::rotate(cut1, middle, cut2);
+      // Récursion sur la plus petite paire : pile en O(log n)
+      if ((mid - first) < (last - mid))
+      {
+        merge_inplace<Cap>(first, cut1, mid, buf, c);
+        first = mid;
+        middle = cut2;
+      }
+      else
+      {
+        merge_inplace<Cap>(mid, cut2, last, buf, c);
+        last = mid;
+        middle = cut1;
+      }
+    }
+  }
+
+  template<std::size_t Cap, class It, class T, class C>
+  void inplace_stable_sort_blocks(It first, std::size_t n, T* buf, C& c)
+  {
+    using V = std::iter_value_t<It>;
+    for (std::size_t b = 0; b < n; b += kStableBlock)
+    {
+      const std::size_t len = std::min(kStableBlock, n - b);
+      if constexpr (kStabilityInvisible<V, C>) sort_small_n(first + b, len, c);
+      else insertion_sort(first + b, first + b + len, c);
+    }
+    // Fusions ascendantes de largeur doublée
+    for (std::size_t w = kStableBlock; w < n; w *= 2)
+      for (std::size_t lo = 0; lo + w < n; lo += 2 * w)
+        merge_inplace<Cap>(first + lo, first + lo + w, first + std::min(lo + 2 * w, n), buf, c);
+  }
+}
+
+/**
+ * Stable sort with O(1) extra memory, for processes that cannot afford the
+ * n / 2 buffer of std::stable_sort. Blocks of 16 elements are sorted first
+ * (with the sorting network when stability is unobservable, i.e. integer
+ * values under operator<, by insertion otherwise), then merged bottom-up.
+ * Each merge goes through a fixed 4 KB stack buffer, branch-free, once one
+ * of its runs fits in it, and splits the runs by rotations until then.
+ * O(n log^2 n) time in the worst case, linear on already sorted input.
+ */
+template<std::random_access_iterator It, class Compare = detail::DefaultLess>
+void inplace_stable_sort(It first, It last, Compare c = {})
+{
+  using T = std::iter_value_t<It>;
+  constexpr std::size_t cap = detail::kMergeBuffer<T>;
+  const std::size_t n = static_cast<std::size_t>(last - first);
+  if (n < 2) return;
+  if constexpr (cap > 0)
+  {
+    T buf[cap];
+    detail::inplace_stable_sort_blocks<cap>(first, n, buf, c);
+  }
+  else detail::inplace_stable_sort_blocks<0>(first, n, static_cast<T*>(nullptr), c);
+}
+
+template<std::ranges::random_access_range R, class Compare = detail::DefaultLess>
+void inplace_stable_sort(R&& range, Compare c = {})
+{
+  inplace_stable_sort(std::ranges::begin(range), std::ranges::end(range), c);
+}
+
+
+namespace detail
+{
+  /**
+   * Running top K (the K smallest under `c`) of a stream. The first K
+   * elements are sorted by StaticSort<K>; after that, every element that
+   * beats the current K-th joins a chunk of candidates, and a full chunk is
+   * sorted and merged with the top K by StaticMultiMerge<2, K, K>, which
+   * keeps only the merged first K. Most elements of a long stream cost one
+   * comparison. After flush(), data()[0..size()) is the top K in order.
+   */
+  template<unsigned K, class T, class C>
+  class TopKBuffer
+  {
+  public:
+    explicit TopKBuffer(C c = {}) : c_(c) {}
+
+    // Vrai si le top K trié a changé
+    bool push(const T& x)
+    {
+      if (size_ < K)
+      {
+        buf_[size_++] = x;
+        if (size_ < K) return false;
+        StaticSort<K>()(buf_.begin(), buf_.begin() + K, c_);
+        return true;
+      }
+      if (!c_(x, buf_[K - 1])) return false;
+      buf_[K + m_++] = x;
+      if (m_ < K) return false;
+      StaticSort<K>()(buf_.begin() + K, buf_.end(), c_);
+      StaticMultiMerge<2, K, K>()(buf_, c_);
+      m_ = 0;
+      return true;
+    }
+
+    // Dernier paquet incomplet : fusion scalaire, sans bourrage qui dupliquerait un élément
+    bool flush()
+    {
+      if (size_ < K)
+      {
+        sort_small(buf_.begin(), buf_.begin() + size_, c_);
+        return size_ > 0;
+      }
+      if (m_ == 0) return false;
+      sort_small(buf_.begin() + K, buf_.begin() + K + m_, c_);
+      std::array<T, K> top;
+      unsigned i = 0, j = K;
+      for (unsigned k = 0; k < K; ++k) top[k] = j < K + m_ && c_(buf_[j], buf_[i]) ? buf_[j++] : buf_[i++];
+      std::copy(top.begin(), top.end(), buf_.begin());
+      m_ = 0;
+      return true;
+    }
+
+    const T* data() const noexcept { return buf_.data(); }
+    unsigned size() const noexcept { return size_; }
+
+  private:
+    std::array<T, 2 * K> buf_;
+    unsigned size_ = 0;  // éléments du top K (K une fois plein)
+    unsigned m_ = 0;  // candidats en attente dans buf_[K..2K)
+    C c_;
+  };
+}
+
+#endif
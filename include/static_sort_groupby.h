@@ -0,0 +1,213 @@
+#ifndef static_sort_groupby_h
+#define static_sort_groupby_h
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "static_sort_engines.h"
+
+// Type des sommes : V pour les flottants, entier de 64 bits du même signe sinon
+template<class V>
+using group_sum_t = std::conditional_t<std::is_floating_point_v<V>, V,
+                                       std::conditional_t<std::is_signed_v<V>, std::int64_t, std::uint64_t>>;
+
+/**
+ * Result of group_by(): one entry per distinct key, keys ascending.
+ * count[g], sum[g], min[g] and max[g] aggregate the values of key keys[g].
+ */
+template<class Key, class V>
+struct GroupByResult
+{
+  std::vector<Key> keys;
+  std::vector<std::uint32_t> count;
+  std::vector<group_sum_t<V>> sum;
+  std::vector<V> min;
+  std::vector<V> max;
+};
+
+namespace detail
+{
+  inline constexpr std::size_t kGroupLanes = 32;  // octets par accumulateur : un registre AVX2
+
+  template<class K>
+  concept GroupKey = std::integral<K> || std::is_enum_v<K>;
+
+  // Fin de la suite de clés égales à key(p[first]) : galop puis dichotomie, O(log longueur)
+  template<class P, class KeyOf>
+  std::size_t run_end(const P* p, std::size_t first, std::size_t n, KeyOf& key) noexcept
+  {
+    const auto k = key(p[first]);
+    std::size_t lo = first + 1, step = 1;
+    while (lo + step <= n && key(p[lo + step - 1]) == k)
+    {
+      lo += step;
+      step *= 2;
+    }
+    return static_cast<std::size_t>(std::partition_point(p + lo, p + std::min(lo + step, n),
+                                                         [&](const P& x) { return key(x) == k; }) - p);
+  }
+
+  /**
+   * Sum, min and max of value(p[0..n)), n >= 1, in W independent lanes of
+   * one vector register each, reduced at the end: the loop carries no
+   * dependency from one element to the next.
+   */
+  template<class V, class S, class P, class ValueOf>
+  void reduce_run(const P* p, std::size_t n, ValueOf& value, S& sum, V& lo, V& hi) noexcept
+  {
+    constexpr std::size_t W = kGroupLanes / sizeof(S);
+    std::size_t i = 0;
+    S s = 0;
+    V mn = value(p[0]), mx = mn;
+    if (n >= W)
+    {
+      Lanes<S, W> vs{};
+      Lanes<V, W> vmn, vmx;
+      for (std::size_t k = 0; k < W; ++k) vmn.v[k] = vmx.v[k] = mn;
+      for (; i + W <= n; i += W)
+      {
+        Lanes<V, W> x;
+        Lanes<S, W> xs;
+        for (std::size_t k = 0; k < W; ++k)
+        {
+          x.v[k] = value(p[i + k]);
+          xs.v[k] = static_cast<S>(x.v[k]);
+        }
+#if defined(__GNUC__) || defined(__clang__)
+        vs.v += xs.v;
+        vmn.v = x.v < vmn.v ? x.v : vmn.v;
+        vmx.v = vmx.v < x.v ? x.v : vmx.v;
+#else
+        for (std::size_t k = 0; k < W; ++k)
+        {
+          vs.v[k] += xs.v[k];
+          vmn.v[k] = x.v[k] < vmn.v[k] ? x.v[k] : vmn.v[k];
+          vmx.v[k] = vmx.v[k] < x.v[k] ? x.v[k] : vmx.v[k];
+        }
+#endif
+      }
+      for (std::size_t k = 0; k < W; ++k)
+      {
+        s += vs.v[k];
+        mn = vmn.v[k] < mn ? vmn.v[k] : mn;
+        mx = mx < vmx.v[k] ? vmx.v[k] : mx;
+      }
+    }
+    for (; i < n; ++i)
+    {
+      const V x = value(p[i]);
+      s += static_cast<S>(x);
+      mn = x < mn ? x : mn;
+      mx = mx < x ? x : mx;
+    }
+    sum = s;
+    lo = mn;
+    hi = mx;
+  }
+
+  // Une entrée de résultat par suite de clés égales de sorted[0..n)
+  template<class Key, class V, class P, class KeyOf, class ValueOf>
+  void aggregate_runs(const P* sorted, std::size_t n, KeyOf key, ValueOf value, GroupByResult<Key, V>& r)
+  {
+    for (std::size_t i = 0; i < n;)
+    {
+      const std::size_t e = run_end(sorted, i, n, key);
+      group_sum_t<V> s;
+      V lo, hi;
+      reduce_run(sorted + i, e - i, value, s, lo, hi);
+      r.keys.push_back(key(sorted[i]));
+      r.count.push_back(static_cast<std::uint32_t>(e - i));
+      r.sum.push_back(s);
+      r.min.push_back(lo);
+      r.max.push_back(hi);
+      i = e;
+    }
+  }
+}
+
+/**
+ * Sort-based group-by: count, sum, min and max of `values` per distinct
+ * value of `keys` (the two columns have the same length).
+ *
+ * The rows are sorted by key with the packed engines: sorting networks for
+ * batches of at most 16 rows, introsort up to 512 and the radix sort on the
+ * key bytes beyond (a single pass for fewer than 256 distinct keys). When
+ * key and value both fit in 4 bytes, each row is one 64-bit integer
+ * (key << 32 | value bits) and the values travel with their keys; otherwise
+ * (key, row) pairs are sorted and the values gathered in key order. One pass
+ * over the runs of equal keys then finds each run end by galloping and
+ * reduces the run in vector lanes, so few distinct keys cost little more
+ * than reading the values once.
+ *
+ * Integer sums are accumulated on 64 bits; floating-point sums in several
+ * partial sums, so their rounding differs from a sequential sum. Values
+ * must not be NaN. At most 2^32 - 1 rows. Temporary arrays come from `mr`.
+ */
+template<detail::GroupKey Key, class V>
+  requires std::is_arithmetic_v<V> && (!std::is_same_v<V, bool>) && (sizeof(V) <= 8)
+GroupByResult<Key, V> group_by(std::span<const Key> keys, std::span<const V> values,
+                               std::pmr::memory_resource* mr = std::pmr::get_default_resource())
+{
+  using Raw = typename std::conditional_t<std::is_enum_v<Key>, std::underlying_type<Key>, std::type_identity<Key>>::type;
+  using U = detail::ordered_bits_t<Raw>;
+  const std::size_t n = std::min(keys.size(), values.size());
+  GroupByResult<Key, V> r;
+  if (n == 0) return r;
+
+  // Sur les entiers, ordered_bits est sa propre inverse (inversion du bit de signe)
+  auto to_key = [](U u) { return static_cast<Key>(static_cast<Raw>(detail::ordered_bits(static_cast<Raw>(u)))); };
+  if constexpr (sizeof(U) <= 4 && sizeof(V) <= 4)
+  {
+    using VB = detail::ordered_bits_t<V>;  // entier non signé de la taille de V
+    std::pmr::vector<std::uint64_t> packed(n, mr);
+    for (std::size_t i = 0; i < n; ++i)
+      packed[i] = (std::uint64_t(detail::ordered_bits(static_cast<Raw>(keys[i]))) << 32) | std::bit_cast<VB>(values[i]);
+    if (n < detail::kRadixThreshold) hybrid_sort(packed.begin(), packed.end());
+    else
+    {
+      std::pmr::vector<std::uint64_t> scratch(n, mr);
+      radix_sort(std::span(packed), std::span(scratch), [](std::uint64_t x) { return U(x >> 32); });
+    }
+    detail::aggregate_runs(packed.data(), n, [&](std::uint64_t x) { return to_key(U(x >> 32)); },
+                           [](std::uint64_t x) { return std::bit_cast<V>(static_cast<VB>(x)); }, r);
+  }
+  else
+  {
+    std::pmr::vector<U> bits(n, mr);
+    for (std::size_t i = 0; i < n; ++i) bits[i] = detail::ordered_bits(static_cast<Raw>(keys[i]));
+    std::pmr::vector<std::uint32_t> order(n, mr);
+    detail::sort_key_index<U>(bits, order, mr);
+    // Lignes dans l'ordre trié : les suites sont contiguës
+    struct Row
+    {
+      U key;
+      V value;
+    };
+    std::pmr::vector<Row> rows(n, mr);
+    for (std::size_t i = 0; i < n; ++i) rows[i] = {bits[order[i]], values[order[i]]};
+    detail::aggregate_runs(rows.data(), n, [&](const Row& x) { return to_key(x.key); },
+                           [](const Row& x) { return x.value; }, r);
+  }
+  return r;
+}
+
+// Variante sur des conteneurs : group_by(region, revenue)
+template<std::ranges::contiguous_range RK, std::ranges::contiguous_range RV>
+  requires std::ranges::sized_range<RK> && std::ranges::sized_range<RV>
+auto group_by(const RK& keys, const RV& values, std::pmr::memory_resource* mr = std::pmr::get_default_resource())
+{
+  using Key = std::ranges::range_value_t<RK>;
+  using V = std::ranges::range_value_t<RV>;
+  return group_by(std::span<const Key>(std::ranges::data(keys), std::ranges::size(keys)),
+                  std::span<const V>(std::ranges::data(values), std::ranges::size(values)), mr);
+}
+
+#endif
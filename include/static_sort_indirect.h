@@ -0,0 +1,78 @@
+#ifndef static_sort_indirect_h
+#define static_sort_indirect_h
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "static_sort_engines.h"
+
+namespace detail
+{
+  // Distance de préchargement (en objets) pour la collecte des clés
+  inline constexpr std::size_t kPointeePrefetch = 16;
+
+  template<class K>
+  concept PointeeKey = (std::is_arithmetic_v<K> && !std::is_same_v<K, bool>) || std::is_enum_v<K>;
+}
+
+/**
+ * Sorts `ptrs` by key(*ptrs[i]), ascending, keeping equal keys in their
+ * input order. Comparison sorts on pointers miss the cache twice per
+ * comparison; here every pointee is read exactly once:
+ * 1. one pass gathers the keys into a contiguous array, prefetching the
+ *    pointees 16 objects ahead so that the misses overlap;
+ * 2. the keys, mapped to order-preserving unsigned integers, are sorted
+ *    together with their indices by the packed engines (networks and
+ *    introsort when short, radix sort otherwise);
+ * 3. the pointers are permuted by the resulting order.
+ *
+ * `P` is any pointer-like type (raw pointer, std::unique_ptr, ...); it is
+ * moved during the permutation. At most 2^32 - 1 elements. Temporary arrays
+ * come from `mr`. For a descending order, negate a signed or floating-point key.
+ */
+template<class P, class KeyFn>
+  requires detail::PointeeKey<std::remove_cvref_t<std::invoke_result_t<KeyFn&, decltype(*std::declval<P&>())>>>
+void sort_by_pointee(std::span<P> ptrs, KeyFn key, std::pmr::memory_resource* mr = std::pmr::get_default_resource())
+{
+  using K = std::remove_cvref_t<std::invoke_result_t<KeyFn&, decltype(*std::declval<P&>())>>;
+  using Raw = typename std::conditional_t<std::is_enum_v<K>, std::underlying_type<K>, std::type_identity<K>>::type;
+  using U = detail::ordered_bits_t<Raw>;
+  const std::size_t n = ptrs.size();
+  if (n < 2) return;
+
+  std::pmr::vector<U> keys(n, mr);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    if (i + detail::kPointeePrefetch < n) __builtin_prefetch(std::to_address(ptrs[i + detail::kPointeePrefetch]));
+#endif
+    keys[i] = detail::ordered_bits(static_cast<Raw>(std::invoke(key, *ptrs[i])));
+  }
+
+  std::pmr::vector<std::uint32_t> order(n, mr);
+  detail::sort_key_index<U>(keys, order, mr);
+
+  std::pmr::vector<P> sorted(mr);
+  sorted.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) sorted.push_back(std::move(ptrs[order[i]]));
+  std::move(sorted.begin(), sorted.end(), ptrs.begin());
+}
+
+// Variante sur un conteneur : sort_by_pointee(entities, &Entity::priority)
+template<std::ranges::contiguous_range R, class KeyFn>
+  requires std::ranges::sized_range<R>
+void sort_by_pointee(R& range, KeyFn key, std::pmr::memory_resource* mr = std::pmr::get_default_resource())
+{
+  using P = std::remove_reference_t<std::ranges::range_reference_t<R>>;
+  sort_by_pointee(std::span<P>(std::ranges::data(range), std::ranges::size(range)), key, mr);
+}
+
+#endif
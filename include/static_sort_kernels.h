@@ -0,0 +1,38 @@
+#ifndef static_sort_kernels_h
+#define static_sort_kernels_h
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/*
+ Precompiled sorting networks. sort_kernel<N, T> is explicitly instantiated in
+ the static_sort_kernels library (-DSTATIC_SORT_BUILD_KERNELS=ON) for N in
+ 2..32 and T in int32_t, int64_t, uint64_t, float and double, so including this
+ header instead of static_sort.h keeps the PS/PB template trees out of the
+ caller's translation unit. Other sizes and types keep using StaticSort<N>.
+ */
+
+template<class T>
+concept KernelElement = std::is_same_v<T, std::int32_t> || std::is_same_v<T, std::int64_t> ||
+                        std::is_same_v<T, std::uint64_t> || std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+// Trie data[0..N)
+template<unsigned N, KernelElement T>
+  requires (N >= 2 && N <= 32)
+void sort_kernel(T* data) noexcept;
+
+// Trie `count` tableaux consécutifs de N éléments
+template<unsigned N, KernelElement T>
+  requires (N >= 2 && N <= 32)
+void sort_kernel_batch(T* data, std::size_t count) noexcept;
+
+template<KernelElement T, std::size_t N>
+  requires (N >= 2 && N <= 32)
+inline void sort_kernel(std::array<T, N>& arr) noexcept
+{
+  sort_kernel<static_cast<unsigned>(N)>(arr.data());
+}
+
+#endif
@@ -0,0 +1,167 @@
+#ifndef static_sort_lazy_h
+#define static_sort_lazy_h
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <vector>
+
+#include "static_sort_engines.h"
+
+/**
+ * A view over a random access range that sorts it only as far as it is read.
+ *
+ * Reading position k sorts the prefix [0, k] by incremental quickselect:
+ * the unsorted part is kept as a stack of partition boundaries, the leftmost
+ * segment is partitioned until it is short enough for a sorting network, and
+ * the network output is appended to the sorted prefix. When the requested
+ * prefix is short compared to the segment, the pivot is sampled near the
+ * requested rank instead of taking a median of three. Reading the first k
+ * elements costs about O(n + k log k); elements past the consumed prefix are
+ * left partitioned but unsorted.
+ *
+ * The view reorders the underlying range in place and is invalidated if the
+ * range is modified through another path.
+ * \tparam It       Random access iterator of the underlying range.
+ * \tparam Compare  Strict weak ordering, defaults to operator<.
+ */
+template<std::random_access_iterator It, class Compare = detail::DefaultLess>
+class lazy_sorted_view
+{
+public:
+  using value_type = std::iter_value_t<It>;
+  using reference = std::iter_reference_t<It>;
+
+  class iterator
+  {
+  public:
+    using iterator_concept = std::random_access_iterator_tag;
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::iter_value_t<It>;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::iter_reference_t<It>;
+
+    iterator() = default;
+    iterator(lazy_sorted_view* view, std::size_t pos) noexcept : view_(view), pos_(pos) {}
+
+    reference operator*() const { return (*view_)[pos_]; }
+    reference operator[](difference_type n) const { return (*view_)[pos_ + n]; }
+
+    iterator& operator++() noexcept { ++pos_; return *this; }
+    iterator operator++(int) noexcept { auto t = *this; ++pos_; return t; }
+    iterator& operator--() noexcept { --pos_; return *this; }
+    iterator operator--(int) noexcept { auto t = *this; --pos_; return t; }
+    iterator& operator+=(difference_type n) noexcept { pos_ += n; return *this; }
+    iterator& operator-=(difference_type n) noexcept { pos_ -= n; return *this; }
+    friend iterator operator+(iterator i, difference_type n) noexcept { return i += n; }
+    friend iterator operator+(difference_type n, iterator i) noexcept { return i += n; }
+    friend iterator operator-(iterator i, difference_type n) noexcept { return i -= n; }
+    friend difference_type operator-(const iterator& a, const iterator& b) noexcept
+    {
+      return static_cast<difference_type>(a.pos_) - static_cast<difference_type>(b.pos_);
+    }
+    friend bool operator==(const iterator& a, const iterator& b) noexcept { return a.pos_ == b.pos_; }
+    friend auto operator<=>(const iterator& a, const iterator& b) noexcept { return a.pos_ <=> b.pos_; }
+
+  private:
+    lazy_sorted_view* view_ = nullptr;
+    std::size_t pos_ = 0;
+  };
+
+  lazy_sorted_view(It first, It last, Compare c = {})
+    : first_(first), size_(static_cast<std::size_t>(last - first)), cmp_(c)
+  {
+    bounds_.reserve(2 * std::bit_width(size_) + 1);
+    if (size_) bounds_.push_back(size_);
+  }
+
+  template<std::ranges::random_access_range R>
+  explicit lazy_sorted_view(R& range, Compare c = {})
+    : lazy_sorted_view(std::ranges::begin(range), std::ranges::end(range), c) {}
+
+  iterator begin() noexcept { return iterator(this, 0); }
+  iterator end() noexcept { return iterator(this, size_); }
+  std::size_t size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+
+  // Élément de rang i ; trie le préfixe jusqu'à i si nécessaire
+  reference operator[](std::size_t i)
+  {
+    ensure_sorted(i + 1);
+    return first_[i];
+  }
+
+  reference front() { return (*this)[0]; }
+
+  // Nombre d'éléments déjà triés en tête de la plage
+  std::size_t sorted_prefix() const noexcept { return sorted_; }
+
+  // Trie au moins les `count` premiers éléments
+  void ensure_sorted(std::size_t count)
+  {
+    count = std::min(count, size_);
+    while (sorted_ < count)
+    {
+      const std::size_t top = bounds_.back();
+      std::size_t rounds = 0;
+      std::size_t end = top;
+      // Partitionne le segment de tête jusqu'à une feuille de réseau
+      while (end - sorted_ > detail::kNetworkLeaf)
+      {
+        if (++rounds > static_cast<std::size_t>(detail::introsort_depth(end - sorted_)))
+        {
+          // Partitions dégénérées : on trie le segment d'un bloc
+          hybrid_sort(first_ + sorted_, first_ + end, cmp_);
+          break;
+        }
+        std::size_t cut = sorted_;
+        // Préfixe demandé court devant le segment : pivot échantillonné près du rang visé
+        if (end - sorted_ >= kSampledSegment && (count - sorted_) * 8 < end - sorted_)
+          cut = sampled_partition(end, count - sorted_);
+        if (cut == sorted_ || cut == end)
+          cut = static_cast<std::size_t>(detail::partition_pivot(first_ + sorted_, first_ + end, cmp_) - first_);
+        end = cut;
+        bounds_.push_back(end);
+      }
+      if (end - sorted_ <= detail::kNetworkLeaf)
+        detail::sort_small_n(first_ + sorted_, end - sorted_, cmp_);
+      sorted_ = end;
+      while (!bounds_.empty() && bounds_.back() <= sorted_) bounds_.pop_back();
+    }
+  }
+
+private:
+  static constexpr std::size_t kSamples = 64;
+  static constexpr std::size_t kSampledSegment = 1024;
+
+  /**
+   * Partitions [sorted_, end) around a pivot sampled a little above rank
+   * `wanted`, so that the left part is short and the partition branch is
+   * well predicted. Returns the cut, or sorted_ if nothing went left.
+   */
+  std::size_t sampled_partition(std::size_t end, std::size_t wanted)
+  {
+    const std::size_t len = end - sorted_;
+    std::array<value_type, kSamples> sample;
+    for (std::size_t i = 0; i < kSamples; ++i) sample[i] = first_[sorted_ + i * (len / kSamples)];
+    const std::size_t rank = std::min(kSamples - 1, wanted * kSamples / len + 4);
+    network_select(sample.begin(), sample.begin() + rank, sample.end(), cmp_);
+    const value_type& pivot = sample[rank];
+    auto mid = std::partition(first_ + sorted_, first_ + end, [&](const auto& x) { return cmp_(x, pivot); });
+    return static_cast<std::size_t>(mid - first_);
+  }
+
+  It first_;
+  std::size_t size_;
+  Compare cmp_;
+  std::size_t sorted_ = 0;
+  std::vector<std::size_t> bounds_;  // bornes droites des segments non triés, décroissantes
+};
+
+template<std::ranges::random_access_range R, class Compare = detail::DefaultLess>
+lazy_sorted_view(R&, Compare = {}) -> lazy_sorted_view<std::ranges::iterator_t<R>, Compare>;
+
+#endif
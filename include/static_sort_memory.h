@@ -0,0 +1,121 @@
+#ifndef static_sort_memory_h
+#define static_sort_memory_h
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+/**
+ * Scratch arena for the large-array engines, usable wherever they take a
+ * std::pmr::memory_resource* (PermutationApplier, LoserTreeMerger,
+ * kway_merge, morton_order, coo_to_csr, static_sort_async).
+ *
+ * The arena reserves `capacity` bytes once, rounded up to 2 MB pages. On
+ * Linux it asks for explicit huge pages (MAP_HUGETLB) and otherwise maps
+ * ordinary memory aligned on 2 MB with MADV_HUGEPAGE, so that transparent
+ * huge pages back the scratch buffers and large sorts take fewer TLB misses.
+ * Allocations are carved from the front; a deallocation of the most recent
+ * block gives its memory back, so the scratch buffers of a sort, freed in
+ * reverse order, are reused by the next sort without touching the heap.
+ * Requests that do not fit go to `upstream`.
+ *
+ * Like std::pmr::monotonic_buffer_resource, the arena is not thread-safe:
+ * use one arena per thread or per request.
+ */
+class HugePageArena : public std::pmr::memory_resource
+{
+public:
+  static constexpr std::size_t kHugePage = std::size_t(2) << 20;
+
+  explicit HugePageArena(std::size_t capacity, std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+    : upstream_(upstream)
+  {
+    capacity_ = (std::max<std::size_t>(capacity, 1) + kHugePage - 1) / kHugePage * kHugePage;
+#if defined(__linux__)
+    void* p = MAP_FAILED;
+#if defined(MAP_HUGETLB)
+    p = ::mmap(nullptr, capacity_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (p != MAP_FAILED)
+    {
+      base_ = static_cast<std::byte*>(p);
+      huge_pages_ = true;
+      return;
+    }
+#endif
+    // Pages ordinaires : une page de plus pour aligner la zone sur 2 Mo
+    p = ::mmap(nullptr, capacity_ + kHugePage, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) throw std::bad_alloc();
+    auto* raw = static_cast<std::byte*>(p);
+    base_ = raw + (kHugePage - reinterpret_cast<std::uintptr_t>(raw) % kHugePage) % kHugePage;
+    const std::size_t head = static_cast<std::size_t>(base_ - raw);
+    if (head) ::munmap(raw, head);
+    if (head != kHugePage) ::munmap(base_ + capacity_, kHugePage - head);
+#if defined(MADV_HUGEPAGE)
+    huge_pages_ = ::madvise(base_, capacity_, MADV_HUGEPAGE) == 0;
+#endif
+#else
+    base_ = static_cast<std::byte*>(::operator new(capacity_, std::align_val_t{kHugePage}));
+#endif
+  }
+
+  HugePageArena(const HugePageArena&) = delete;
+  HugePageArena& operator=(const HugePageArena&) = delete;
+
+  ~HugePageArena() override
+  {
+#if defined(__linux__)
+    ::munmap(base_, capacity_);
+#else
+    ::operator delete(base_, std::align_val_t{kHugePage});
+#endif
+  }
+
+  // Rend toute la zone d'un coup ; les blocs encore vivants ne doivent plus servir
+  void release() noexcept { top_ = 0; }
+
+  std::size_t capacity() const noexcept { return capacity_; }
+  std::size_t used() const noexcept { return top_; }
+  // Vrai si la zone est adossée à des pages de 2 Mo (explicites ou transparentes conseillées)
+  bool huge_pages() const noexcept { return huge_pages_; }
+
+protected:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override
+  {
+    const std::size_t start = (top_ + alignment - 1) & ~(alignment - 1);
+    if (start <= capacity_ && bytes <= capacity_ - start)
+    {
+      top_ = start + bytes;
+      return base_ + start;
+    }
+    return upstream_->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+  {
+    auto* b = static_cast<std::byte*>(p);
+    if (b >= base_ && b < base_ + capacity_)
+    {
+      // Dernier bloc alloué : le sommet recule (le bourrage d'alignement reste perdu)
+      if (b + bytes == base_ + top_) top_ = static_cast<std::size_t>(b - base_);
+      return;
+    }
+    upstream_->deallocate(p, bytes, alignment);
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+private:
+  std::pmr::memory_resource* upstream_;
+  std::byte* base_ = nullptr;
+  std::size_t capacity_ = 0;
+  std::size_t top_ = 0;
+  bool huge_pages_ = false;
+};
+
+#endif
@@ -0,0 +1,240 @@
+#ifndef static_sort_merge_h
+#define static_sort_merge_h
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory_resource>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "static_sort.h"
+
+/**
+ * Stable k-way merge of sorted runs with a loser tree.
+ *
+ * Every node of the tree stores a copy of its loser's head together with the
+ * run index, in a flat array indexed like a binary heap, so a replay walks
+ * log2(k) contiguous nodes without dereferencing the runs. For arithmetic
+ * keys the matches are evaluated without branches.
+ * When the same run wins twice in a row, the merger switches to block mode:
+ * it takes the best loser on the winner's path as a bound and copies whole
+ * blocks of the winning run while their last element does not exceed it.
+ * Long ascending stretches (typical of log merging) thus cost one comparison
+ * per block instead of one replay per element.
+ *
+ * Equal elements are emitted in run order. The merger owns its tree storage,
+ * taken from `mr`; merge() does not allocate once reserve() has covered the
+ * number of runs.
+ * \tparam T        Element type.
+ * \tparam Compare  Strict weak ordering, defaults to operator<.
+ */
+template<class T, class Compare = detail::DefaultLess>
+class LoserTreeMerger
+{
+public:
+  explicit LoserTreeMerger(std::size_t max_runs = 0, Compare c = {},
+                           std::pmr::memory_resource* mr = std::pmr::get_default_resource())
+    : cmp_(c), tree_(mr), pos_(mr), end_(mr)
+  {
+    reserve(max_runs);
+  }
+
+  void reserve(std::size_t max_runs)
+  {
+    const std::size_t leaves = std::bit_ceil(std::max<std::size_t>(max_runs, 1));
+    tree_.reserve(leaves);
+    pos_.reserve(leaves);
+    end_.reserve(leaves);
+  }
+
+  /**
+   * Merges the sorted runs into `out` and returns the iterator past the last
+   * element written. Runs may be empty.
+   */
+  template<std::output_iterator<const T&> Out>
+  Out merge(std::span<const std::span<const T>> runs, Out out)
+  {
+    const std::size_t k = runs.size();
+    if (k == 0) return out;
+    if (k == 1) return std::ranges::copy(runs[0], out).out;
+
+    leaves_ = std::bit_ceil(k);
+    tree_.resize(leaves_);
+    pos_.assign(leaves_, nullptr);
+    end_.assign(leaves_, nullptr);
+    for (std::size_t r = 0; r < k; ++r)
+    {
+      pos_[r] = runs[r].data();
+      end_[r] = runs[r].data() + runs[r].size();
+    }
+    tree_[0] = init(1);
+
+    std::uint32_t previous = kDead;
+    for (;;)
+    {
+      Node& w = tree_[0];
+      if (w.run & kDead) break;
+      const std::uint32_t r = w.run;
+      if (r == previous) out = emit_blocks(out);
+      else
+      {
+        *out++ = w.key;
+        advance(w);
+      }
+      previous = r;
+      replay(r);
+    }
+    return out;
+  }
+
+private:
+  static constexpr std::size_t kBlock = 16;
+  static constexpr std::size_t kPrefetch = 128 / sizeof(T) + 1;
+  // Bit de poids fort de l'indice : run épuisé ou feuille de bourrage, perd tous ses matchs
+  static constexpr std::uint32_t kDead = 0x80000000u;
+  static constexpr bool kBranchless = std::is_arithmetic_v<T> && std::is_same_v<Compare, detail::DefaultLess>;
+
+  struct Node
+  {
+    T key{};
+    std::uint32_t run = kDead;
+  };
+
+  // a bat b : vivant contre mort, sinon tête plus petite, à égalité run d'indice inférieur (stabilité)
+  STATIC_SORT_FORCE_INLINE bool beats(const Node& a, const Node& b) const
+  {
+    if constexpr (kBranchless)
+    {
+      // Pas de court-circuit : le compilateur produit des setcc/cmov
+      const bool lt = a.key < b.key;
+      const bool gt = b.key < a.key;
+      const bool da = a.run & kDead;
+      const bool db = b.run & kDead;
+      return (!da & db) | ((da == db) & (lt | (!gt & (a.run < b.run))));
+    }
+    else
+    {
+      if ((a.run | b.run) & kDead) return a.run < b.run;
+      if (cmp_(a.key, b.key)) return true;
+      if (cmp_(b.key, a.key)) return false;
+      return a.run < b.run;
+    }
+  }
+
+  Node init(std::size_t node)
+  {
+    if (node >= leaves_)
+    {
+      const std::size_t r = node - leaves_;
+      Node leaf;
+      if (pos_[r] != end_[r]) { leaf.key = *pos_[r]; leaf.run = static_cast<std::uint32_t>(r); }
+      return leaf;
+    }
+    Node a = init(2 * node);
+    Node b = init(2 * node + 1);
+    if (beats(b, a)) { tree_[node] = std::move(a); return b; }
+    tree_[node] = std::move(b);
+    return a;
+  }
+
+  void advance(Node& w)
+  {
+    const T* p = ++pos_[w.run];
+    if (p != end_[w.run])
+    {
+      w.key = *p;
+#if defined(__GNUC__) || defined(__clang__)
+      // Trop de flux pour le préchargeur matériel quand k est grand
+      if (end_[w.run] - p > static_cast<std::ptrdiff_t>(kPrefetch)) __builtin_prefetch(p + kPrefetch);
+#endif
+    }
+    else w.run |= kDead;
+  }
+
+  void replay(std::uint32_t leaf)
+  {
+    if constexpr (kBranchless)
+    {
+      // Gagnant gardé en registre le long du chemin
+      Node w = tree_[0];
+      for (std::size_t node = (leaves_ + leaf) / 2; node >= 1; node /= 2)
+      {
+        const Node other = tree_[node];
+        const bool swap = beats(other, w);
+        tree_[node] = swap ? w : other;
+        w = swap ? other : w;
+      }
+      tree_[0] = w;
+    }
+    else
+    {
+      Node& w = tree_[0];
+      for (std::size_t node = (leaves_ + leaf) / 2; node >= 1; node /= 2)
+        if (beats(tree_[node], w)) std::swap(tree_[node], w);
+    }
+  }
+
+  // Meilleur perdant sur le chemin du gagnant : borne du prochain tour
+  const Node& challenger(std::uint32_t leaf) const
+  {
+    std::size_t node = (leaves_ + leaf) / 2;
+    const Node* best = &tree_[node];
+    for (node /= 2; node >= 1; node /= 2)
+      if (beats(tree_[node], *best)) best = &tree_[node];
+    return *best;
+  }
+
+  // Copie par blocs les éléments du run gagnant qui passent avant le challenger
+  template<class Out>
+  Out emit_blocks(Out out)
+  {
+    Node& w = tree_[0];
+    const std::uint32_t r = w.run;
+    const Node& c = challenger(r);
+    const T* p = pos_[r];
+    const T* e = end_[r];
+    if (c.run & kDead)
+    {
+      out = std::copy(p, e, out);
+      pos_[r] = e;
+      w.run |= kDead;
+      return out;
+    }
+
+    // À égalité, le run gagnant passe devant seulement si son indice est inférieur
+    auto before = [&](const T& x) { return r < c.run ? !cmp_(c.key, x) : cmp_(x, c.key); };
+    const T* const head = p;
+    while (e - p >= static_cast<std::ptrdiff_t>(kBlock) && before(p[kBlock - 1]))
+    {
+      out = std::copy(p, p + kBlock, out);
+      p += kBlock;
+    }
+    // La tête a gagné le tour : elle sort même si aucun bloc n'a été copié
+    if (p == head) *out++ = *p++;
+    while (p != e && before(*p)) *out++ = *p++;
+    pos_[r] = p;
+    if (p != e) w.key = *p;
+    else w.run |= kDead;
+    return out;
+  }
+
+  Compare cmp_;
+  std::size_t leaves_ = 0;
+  std::pmr::vector<Node> tree_;  // tree_[0] : gagnant, tree_[1..] : perdants
+  std::pmr::vector<const T*> pos_;
+  std::pmr::vector<const T*> end_;
+};
+
+// Fusion k-voies ponctuelle (alloue l'arbre à chaque appel, depuis `mr`)
+template<class T, std::output_iterator<const T&> Out, class Compare = detail::DefaultLess>
+Out kway_merge(std::span<const std::span<const T>> runs, Out out, Compare c = {},
+               std::pmr::memory_resource* mr = std::pmr::get_default_resource())
+{
+  return LoserTreeMerger<T, Compare>(runs.size(), c, mr).merge(runs, out);
+}
+
+#endif
@@ -0,0 +1,207 @@
+#ifndef static_sort_morton_h
+#define static_sort_morton_h
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "static_sort_engines.h"
+
+// pdep BMI2 ; désactivable (interfaces de module GCC < 14, qui ne sérialisent pas les intrinsèques x86)
+#if !defined(STATIC_SORT_USE_PDEP)
+#if defined(__BMI2__)
+#define STATIC_SORT_USE_PDEP 1
+#else
+#define STATIC_SORT_USE_PDEP 0
+#endif
+#endif
+
+#if STATIC_SORT_USE_PDEP
+#include <immintrin.h>
+#endif
+
+/*
+ Morton (Z-order) keys for 2-D and 3-D points and sorting by space-filling
+ curve order. Bits are interleaved with BMI2 pdep when available, otherwise
+ with the classic magic-number dilation, which the compiler vectorizes when
+ keys are computed over arrays of points.
+ */
+
+namespace detail
+{
+  // Dilatation : insère 1 (resp. 2) bit(s) nul(s) entre les bits de x
+  constexpr std::uint32_t dilate2_32(std::uint32_t x) noexcept
+  {
+    x &= 0x0000FFFFu;
+    x = (x | (x << 8)) & 0x00FF00FFu;
+    x = (x | (x << 4)) & 0x0F0F0F0Fu;
+    x = (x | (x << 2)) & 0x33333333u;
+    x = (x | (x << 1)) & 0x55555555u;
+    return x;
+  }
+
+  constexpr std::uint32_t dilate3_32(std::uint32_t x) noexcept
+  {
+    x &= 0x000003FFu;
+    x = (x | (x << 16)) & 0x030000FFu;
+    x = (x | (x << 8)) & 0x0300F00Fu;
+    x = (x | (x << 4)) & 0x030C30C3u;
+    x = (x | (x << 2)) & 0x09249249u;
+    return x;
+  }
+
+  constexpr std::uint64_t dilate2_64(std::uint64_t x) noexcept
+  {
+    x &= 0x00000000FFFFFFFFull;
+    x = (x | (x << 16)) & 0x0000FFFF0000FFFFull;
+    x = (x | (x << 8)) & 0x00FF00FF00FF00FFull;
+    x = (x | (x << 4)) & 0x0F0F0F0F0F0F0F0Full;
+    x = (x | (x << 2)) & 0x3333333333333333ull;
+    x = (x | (x << 1)) & 0x5555555555555555ull;
+    return x;
+  }
+
+  constexpr std::uint64_t dilate3_64(std::uint64_t x) noexcept
+  {
+    x &= 0x00000000001FFFFFull;
+    x = (x | (x << 32)) & 0x001F00000000FFFFull;
+    x = (x | (x << 16)) & 0x001F0000FF0000FFull;
+    x = (x | (x << 8)) & 0x100F00F00F00F00Full;
+    x = (x | (x << 4)) & 0x10C30C30C30C30C3ull;
+    x = (x | (x << 2)) & 0x1249249249249249ull;
+    return x;
+  }
+}
+
+// 2-D, 16 bits par axe
+constexpr std::uint32_t morton2d_32(std::uint32_t x, std::uint32_t y) noexcept
+{
+#if STATIC_SORT_USE_PDEP
+  if (!std::is_constant_evaluated()) return _pdep_u32(x, 0x55555555u) | _pdep_u32(y, 0xAAAAAAAAu);
+#endif
+  return detail::dilate2_32(x) | (detail::dilate2_32(y) << 1);
+}
+
+// 3-D, 10 bits par axe
+constexpr std::uint32_t morton3d_32(std::uint32_t x, std::uint32_t y, std::uint32_t z) noexcept
+{
+#if STATIC_SORT_USE_PDEP
+  if (!std::is_constant_evaluated())
+    return _pdep_u32(x, 0x09249249u) | _pdep_u32(y, 0x12492492u) | _pdep_u32(z, 0x24924924u);
+#endif
+  return detail::dilate3_32(x) | (detail::dilate3_32(y) << 1) | (detail::dilate3_32(z) << 2);
+}
+
+// 2-D, 32 bits par axe
+constexpr std::uint64_t morton2d_64(std::uint64_t x, std::uint64_t y) noexcept
+{
+#if STATIC_SORT_USE_PDEP && defined(__x86_64__)
+  if (!std::is_constant_evaluated())
+    return _pdep_u64(x, 0x5555555555555555ull) | _pdep_u64(y, 0xAAAAAAAAAAAAAAAAull);
+#endif
+  return detail::dilate2_64(x) | (detail::dilate2_64(y) << 1);
+}
+
+// 3-D, 21 bits par axe
+constexpr std::uint64_t morton3d_64(std::uint64_t x, std::uint64_t y, std::uint64_t z) noexcept
+{
+#if STATIC_SORT_USE_PDEP && defined(__x86_64__)
+  if (!std::is_constant_evaluated())
+    return _pdep_u64(x, 0x1249249249249249ull) | _pdep_u64(y, 0x2492492492492492ull) |
+           _pdep_u64(z, 0x4924924924924924ull);
+#endif
+  return detail::dilate3_64(x) | (detail::dilate3_64(y) << 1) | (detail::dilate3_64(z) << 2);
+}
+
+/**
+ * Quantizes floating-point points against a bounding box and returns their
+ * Morton key. Coordinates outside the box are clamped to it.
+ * \tparam Dim  2 or 3.
+ * \tparam Key  std::uint32_t (16 or 10 bits per axis) or std::uint64_t (32 or 21 bits per axis).
+ */
+template<std::size_t Dim, class Key = std::uint32_t>
+  requires (Dim == 2 || Dim == 3) && (std::is_same_v<Key, std::uint32_t> || std::is_same_v<Key, std::uint64_t>)
+class MortonEncoder
+{
+public:
+  using Point = std::array<float, Dim>;
+  static constexpr unsigned kBitsPerAxis = (sizeof(Key) * 8) / Dim > 32 ? 32 : unsigned((sizeof(Key) * 8) / Dim);
+
+  MortonEncoder(const Point& lo, const Point& hi) noexcept : lo_(lo)
+  {
+    constexpr double cells = double((std::uint64_t(1) << kBitsPerAxis) - 1);
+    for (std::size_t d = 0; d < Dim; ++d)
+    {
+      const double extent = double(hi[d]) - double(lo[d]);
+      scale_[d] = extent > 0 ? cells / extent : 0.0;
+    }
+  }
+
+  // Boîte englobante des points
+  static MortonEncoder fit(std::span<const Point> points) noexcept
+  {
+    Point lo, hi;
+    lo.fill(std::numeric_limits<float>::max());
+    hi.fill(std::numeric_limits<float>::lowest());
+    for (const Point& p : points)
+      for (std::size_t d = 0; d < Dim; ++d)
+      {
+        lo[d] = std::min(lo[d], p[d]);
+        hi[d] = std::max(hi[d], p[d]);
+      }
+    if (points.empty()) { lo.fill(0.f); hi.fill(0.f); }
+    return MortonEncoder(lo, hi);
+  }
+
+  Key operator()(const Point& p) const noexcept
+  {
+    constexpr double cells = double((std::uint64_t(1) << kBitsPerAxis) - 1);
+    std::array<Key, Dim> q;
+    for (std::size_t d = 0; d < Dim; ++d)
+      q[d] = static_cast<Key>(std::clamp((double(p[d]) - double(lo_[d])) * scale_[d], 0.0, cells));
+    if constexpr (Dim == 2 && sizeof(Key) == 4) return morton2d_32(q[0], q[1]);
+    else if constexpr (Dim == 3 && sizeof(Key) == 4) return morton3d_32(q[0], q[1], q[2]);
+    else if constexpr (Dim == 2) return morton2d_64(q[0], q[1]);
+    else return morton3d_64(q[0], q[1], q[2]);
+  }
+
+  // Clés de tout un tableau de points
+  void operator()(std::span<const Point> points, std::span<Key> keys) const noexcept
+  {
+    for (std::size_t i = 0; i < points.size(); ++i) keys[i] = (*this)(points[i]);
+  }
+
+private:
+  Point lo_;
+  std::array<double, Dim> scale_;
+};
+
+/**
+ * Computes the Z-order of `points`: order[i] is the index of the i-th point
+ * along the Morton curve of their bounding box. Points with the same key keep
+ * their input order. At most 2^32 - 1 points.
+ * \tparam Key  Key width, see MortonEncoder.
+ * \param points  Contiguous range of std::array<float, 2> or std::array<float, 3>.
+ * \param mr      Source of the key and scratch buffers.
+ */
+template<class Key = std::uint32_t, std::ranges::contiguous_range R>
+void morton_order(const R& points, std::span<std::uint32_t> order,
+                  std::pmr::memory_resource* mr = std::pmr::get_default_resource())
+{
+  using Point = std::remove_cv_t<std::ranges::range_value_t<R>>;
+  constexpr std::size_t Dim = std::tuple_size_v<Point>;
+  const std::span<const Point> pts(std::ranges::data(points), std::ranges::size(points));
+  const auto encode = MortonEncoder<Dim, Key>::fit(pts);
+  std::pmr::vector<Key> keys(pts.size(), mr);
+  encode(pts, std::span<Key>(keys));
+  detail::sort_key_index<Key>(keys, order, mr);
+}
+
+#endif
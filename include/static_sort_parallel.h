@@ -0,0 +1,134 @@
+#ifndef static_sort_parallel_h
+#define static_sort_parallel_h
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * A fixed pool of worker threads for the large-array engines.
+ * The threads are created once; parallel_for() only publishes a job
+ * descriptor and performs no heap allocation, so it can be used on hot paths.
+ * The calling thread takes part in the work as worker 0.
+ */
+class WorkerPool
+{
+public:
+  /**
+   * \param threads  Total number of threads working on a job, the caller included.
+   */
+  explicit WorkerPool(unsigned threads = std::max(1u, std::thread::hardware_concurrency()))
+  {
+    const unsigned extra = threads > 1 ? threads - 1 : 0;
+    workers_.reserve(extra);
+    for (unsigned id = 1; id <= extra; ++id) workers_.emplace_back([this, id] { work(id); });
+  }
+
+  WorkerPool(const WorkerPool&) = delete;
+  WorkerPool& operator=(const WorkerPool&) = delete;
+
+  ~WorkerPool()
+  {
+    {
+      std::lock_guard lock(mutex_);
+      stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto& t : workers_) t.join();
+  }
+
+  // Nombre de threads participant à un job (appelant compris)
+  unsigned size() const noexcept { return static_cast<unsigned>(workers_.size()) + 1; }
+
+  /**
+   * Runs fn(task, worker) for every task in [0, count) and returns when all
+   * are done. `worker` is in [0, size()) and identifies the executing thread,
+   * to index per-thread scratch buffers. fn must not throw.
+   */
+  template<class F>
+  void parallel_for(std::size_t count, F&& fn)
+  {
+    if (count == 0) return;
+    if (workers_.empty() || count == 1)
+    {
+      for (std::size_t i = 0; i < count; ++i) fn(i, 0u);
+      return;
+    }
+
+    using Fn = std::remove_reference_t<F>;
+    std::lock_guard call(call_mutex_);
+    {
+      std::lock_guard lock(mutex_);
+      ctx_ = const_cast<void*>(static_cast<const void*>(std::addressof(fn)));
+      run_ = [](void* ctx, std::size_t i, unsigned w) noexcept { (*static_cast<Fn*>(ctx))(i, w); };
+      count_ = count;
+      next_.store(0, std::memory_order_relaxed);
+      active_ = static_cast<unsigned>(workers_.size());
+      ++generation_;
+    }
+    wake_.notify_all();
+
+    drain(0);
+
+    std::unique_lock lock(mutex_);
+    done_.wait(lock, [this] { return active_ == 0; });
+  }
+
+private:
+  void drain(unsigned worker) noexcept
+  {
+    for (std::size_t i = next_.fetch_add(1, std::memory_order_relaxed); i < count_;
+         i = next_.fetch_add(1, std::memory_order_relaxed))
+      run_(ctx_, i, worker);
+  }
+
+  void work(unsigned id)
+  {
+    std::size_t seen = 0;
+    for (;;)
+    {
+      {
+        std::unique_lock lock(mutex_);
+        wake_.wait(lock, [&] { return stop_ || generation_ != seen; });
+        if (stop_) return;
+        seen = generation_;
+      }
+      drain(id);
+      {
+        std::lock_guard lock(mutex_);
+        if (--active_ == 0) done_.notify_one();
+      }
+    }
+  }
+
+  std::vector<std::thread> workers_;
+  std::mutex call_mutex_;
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::condition_variable done_;
+  void* ctx_ = nullptr;
+  void (*run_)(void*, std::size_t, unsigned) noexcept = nullptr;
+  std::size_t count_ = 0;
+  std::atomic<std::size_t> next_{0};
+  std::size_t generation_ = 0;
+  unsigned active_ = 0;
+  bool stop_ = false;
+};
+
+namespace detail
+{
+  // parallel_for sur un pool optionnel (nullptr : exécution séquentielle)
+  template<class F>
+  void parallel_for(WorkerPool* pool, std::size_t count, F&& fn)
+  {
+    if (pool) pool->parallel_for(count, fn);
+    else for (std::size_t i = 0; i < count; ++i) fn(i, 0u);
+  }
+}
+
+#endif
@@ -0,0 +1,186 @@
+#ifndef static_sort_permute_h
+#define static_sort_permute_h
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <type_traits>
+
+#include "static_sort_parallel.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+/**
+ * A type-erased payload column for PermutationApplier: contiguous storage of
+ * trivially copyable elements of `element_size` bytes.
+ */
+struct PermutationColumn
+{
+  void* data;
+  std::size_t element_size;
+
+  template<class T> requires std::is_trivially_copyable_v<T>
+  PermutationColumn(std::span<T> column) noexcept : data(column.data()), element_size(sizeof(T)) {}
+};
+
+namespace detail
+{
+  // Distance de préchargement (en lignes) pour les lectures aléatoires
+  inline constexpr std::size_t kPermutePrefetch = 32;
+
+  // dst[i] = src[perm[i]] pour un bloc de lignes, avec gathers AVX2 pour 4 et 8 octets
+  template<class T>
+  inline void permute_gather(T* __restrict dst, const T* __restrict src, const std::uint32_t* perm, std::size_t n) noexcept
+  {
+    std::size_t i = 0;
+#if defined(__AVX2__)
+    if constexpr (sizeof(T) == 4)
+    {
+      for (; i + 8 <= n; i += 8)
+      {
+#if defined(__GNUC__) || defined(__clang__)
+        if (i + kPermutePrefetch < n) __builtin_prefetch(src + perm[i + kPermutePrefetch]);
+#endif
+        const __m256i idx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(perm + i));
+        const __m256i v = _mm256_i32gather_epi32(reinterpret_cast<const int*>(src), idx, 4);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), v);
+      }
+    }
+    else if constexpr (sizeof(T) == 8)
+    {
+      for (; i + 4 <= n; i += 4)
+      {
+#if defined(__GNUC__) || defined(__clang__)
+        if (i + kPermutePrefetch < n) __builtin_prefetch(src + perm[i + kPermutePrefetch]);
+#endif
+        const __m128i idx = _mm_loadu_si128(reinterpret_cast<const __m128i*>(perm + i));
+        const __m256i v = _mm256_i32gather_epi64(reinterpret_cast<const long long*>(src), idx, 8);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), v);
+      }
+    }
+#endif
+    for (; i < n; ++i)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+      if (i + kPermutePrefetch < n) __builtin_prefetch(src + perm[i + kPermutePrefetch]);
+#endif
+      dst[i] = src[perm[i]];
+    }
+  }
+
+  // Colonne d'éléments de taille quelconque : copie octet par octet
+  inline void permute_gather_bytes(std::byte* dst, const std::byte* src, const std::uint32_t* perm, std::size_t n,
+                                   std::size_t size) noexcept
+  {
+    for (std::size_t i = 0; i < n; ++i) std::memcpy(dst + i * size, src + std::size_t(perm[i]) * size, size);
+  }
+
+  template<std::size_t Size>
+  struct PermuteWord { unsigned char bytes[Size]; };
+}
+
+/**
+ * Applies one permutation to many payload columns: column[i] <- column[perm[i]]
+ * (the gather order produced by an argsort).
+ *
+ * Columns are distributed over the threads of an optional WorkerPool. Each
+ * thread gathers its column block by block into a private scratch buffer, then
+ * copies it back. Scratch buffers are sized in the constructor or by reserve(),
+ * so apply() performs no allocation as long as the row count fits.
+ */
+class PermutationApplier
+{
+public:
+  /**
+   * \param max_rows          Largest permutation that apply() will receive.
+   * \param max_element_size  Largest column element size, in bytes.
+   * \param pool              Optional pool to process columns in parallel.
+   * \param mr                Source of the scratch buffers (e.g. a HugePageArena).
+   */
+  explicit PermutationApplier(std::size_t max_rows, std::size_t max_element_size = 8, WorkerPool* pool = nullptr,
+                              std::pmr::memory_resource* mr = std::pmr::get_default_resource())
+    : pool_(pool), scratch_(nullptr, ScratchDelete{mr, 0})
+  {
+    reserve(max_rows, max_element_size);
+  }
+
+  void reserve(std::size_t max_rows, std::size_t max_element_size = 8)
+  {
+    const unsigned threads = pool_ ? pool_->size() : 1;
+    // Lignes arrondies au bloc pour garder chaque tampon aligné sur 64 octets
+    stride_ = (max_rows * max_element_size + 63) / 64 * 64;
+    if (stride_ * threads > bytes_)
+    {
+      // Ancien tampon rendu d'abord : une arène peut réutiliser sa place
+      std::pmr::memory_resource* mr = scratch_.get_deleter().mr;
+      scratch_.reset();
+      bytes_ = 0;
+      const std::size_t bytes = stride_ * threads;
+      scratch_ = {static_cast<std::byte*>(mr->allocate(bytes, 64)), ScratchDelete{mr, bytes}};
+      bytes_ = bytes;
+    }
+  }
+
+  /**
+   * Reorders every column by `perm`. All columns must have perm.size() rows,
+   * and perm must be a permutation of [0, perm.size()) with fewer than 2^31 rows.
+   */
+  void apply(std::span<const std::uint32_t> perm, std::span<const PermutationColumn> columns)
+  {
+    const std::size_t rows = perm.size();
+    std::size_t widest = 0;
+    for (const auto& c : columns) widest = std::max(widest, c.element_size);
+    if (rows * widest > stride_) reserve(rows, widest);
+
+    detail::parallel_for(pool_, columns.size(), [&](std::size_t c, unsigned worker) {
+      std::byte* tmp = scratch_.get() + stride_ * worker;
+      const PermutationColumn& col = columns[c];
+      auto* src = static_cast<std::byte*>(col.data);
+      // Blocs de lignes : l'index et le tampon de sortie restent en L1
+      for (std::size_t b = 0; b < rows; b += kBlockRows)
+      {
+        const std::size_t n = std::min(kBlockRows, rows - b);
+        switch (col.element_size)
+        {
+          case 1: detail::permute_gather(reinterpret_cast<std::uint8_t*>(tmp) + b, reinterpret_cast<const std::uint8_t*>(src), perm.data() + b, n); break;
+          case 2: detail::permute_gather(reinterpret_cast<std::uint16_t*>(tmp) + b, reinterpret_cast<const std::uint16_t*>(src), perm.data() + b, n); break;
+          case 4: detail::permute_gather(reinterpret_cast<std::uint32_t*>(tmp) + b, reinterpret_cast<const std::uint32_t*>(src), perm.data() + b, n); break;
+          case 8: detail::permute_gather(reinterpret_cast<std::uint64_t*>(tmp) + b, reinterpret_cast<const std::uint64_t*>(src), perm.data() + b, n); break;
+          case 16: detail::permute_gather(reinterpret_cast<detail::PermuteWord<16>*>(tmp) + b, reinterpret_cast<const detail::PermuteWord<16>*>(src), perm.data() + b, n); break;
+          default: detail::permute_gather_bytes(tmp + b * col.element_size, src, perm.data() + b, n, col.element_size); break;
+        }
+      }
+      std::memcpy(src, tmp, rows * col.element_size);
+    });
+  }
+
+  // Variante pratique : colonnes typées passées directement
+  template<class... T>
+  void apply(std::span<const std::uint32_t> perm, std::span<T>... columns)
+  {
+    const PermutationColumn cols[] = {PermutationColumn(columns)...};
+    apply(perm, std::span<const PermutationColumn>(cols));
+  }
+
+private:
+  static constexpr std::size_t kBlockRows = 4096;
+
+  struct ScratchDelete
+  {
+    std::pmr::memory_resource* mr;
+    std::size_t bytes;
+    void operator()(std::byte* p) const noexcept { mr->deallocate(p, bytes, 64); }
+  };
+
+  WorkerPool* pool_;
+  std::unique_ptr<std::byte[], ScratchDelete> scratch_;
+  std::size_t stride_ = 0;
+  std::size_t bytes_ = 0;
+};
+
+#endif
@@ -0,0 +1,237 @@
+#ifndef static_sort_quantiles_h
+#define static_sort_quantiles_h
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "static_sort_engines.h"
+#include "static_sort_parallel.h"
+
+namespace detail
+{
+  inline constexpr std::size_t kSegmentMinChunk = 1 << 15;  // éléments minimum par tâche
+  inline constexpr std::size_t kQuantileSortMax = 128;  // au-delà : sélections successives
+
+  /**
+   * Splits the segments described by `offsets` into at most `tasks` runs of
+   * consecutive segments holding about the same number of elements.
+   * first[t] .. first[t + 1] are the segments of task t.
+   */
+  inline std::vector<std::size_t> balance_segments(std::span<const std::size_t> offsets, std::size_t tasks)
+  {
+    const std::size_t segments = offsets.size() - 1;
+    const std::size_t base = offsets.front();
+    const std::size_t total = offsets.back() - base;
+    std::vector<std::size_t> first(tasks + 1, segments);
+    first[0] = 0;
+    for (std::size_t t = 1; t < tasks; ++t)
+    {
+      // Premier segment commençant au-delà de la part t du total
+      const std::size_t target = base + total / tasks * t;
+      first[t] = std::max(first[t - 1], static_cast<std::size_t>(
+        std::lower_bound(offsets.begin(), offsets.end() - 1, target) - offsets.begin()));
+    }
+    return first;
+  }
+
+  // Segments [0, segments) répartis sur le pool par paquets d'éléments équilibrés
+  template<class F>
+  void for_each_segment(WorkerPool* pool, std::span<const std::size_t> offsets, F&& fn)
+  {
+    if (offsets.size() < 2) return;
+    const std::size_t workers = pool ? pool->size() : 1;
+    const std::size_t total = offsets.back() - offsets.front();
+    const std::size_t tasks = std::clamp<std::size_t>(total / kSegmentMinChunk, 1, 4 * workers);
+    const std::vector<std::size_t> first = balance_segments(offsets, tasks);
+    parallel_for(pool, tasks, [&](std::size_t t, unsigned) {
+      for (std::size_t s = first[t]; s < first[t + 1]; ++s) fn(s);
+    });
+  }
+}
+
+/**
+ * Sorts every segment [offsets[s], offsets[s + 1]) of `values` independently:
+ * segments of at most 16 elements with the sorting network of their exact
+ * length, longer ones with hybrid_sort(). Runs of consecutive segments with
+ * about the same number of elements are sorted in parallel on `pool`.
+ */
+template<class T, class Compare = detail::DefaultLess>
+void segmented_sort(std::span<T> values, std::span<const std::size_t> offsets, Compare c = {}, WorkerPool* pool = nullptr)
+{
+  detail::for_each_segment(pool, offsets, [&](std::size_t s) {
+    sort_small(values.begin() + offsets[s], values.begin() + offsets[s + 1], c);
+  });
+}
+
+// Type des quantiles : T pour les flottants, double pour les entiers (interpolation)
+template<class T>
+using quantile_t = std::conditional_t<std::is_floating_point_v<T>, T, double>;
+
+/**
+ * Quantiles of every group [group_offsets[g], group_offsets[g + 1]) of
+ * `values`, linearly interpolated between order statistics (type 7 of
+ * Hyndman and Fan, the default of R and NumPy). out[g * qs.size() + k]
+ * receives quantile qs[k] of group g; empty groups get NaN.
+ *
+ * The strategy depends on the group length:
+ * - up to 16 elements, the sorting network of the exact length;
+ * - up to 128 elements, hybrid_sort() then direct reads, one pass serving
+ *   every quantile;
+ * - longer groups, one network_select() per order statistic, each
+ *   restricted to the part of the group above the previous one.
+ * Groups are processed in parallel on `pool`, by runs of about the same
+ * number of elements.
+ *
+ * Like std::nth_element, the elements of each group are reordered.
+ */
+template<class T, std::strict_weak_order<T&, T&> Compare = detail::DefaultLess>
+void grouped_quantiles(std::span<T> values, std::span<const std::size_t> group_offsets, std::span<const double> qs,
+                       std::span<quantile_t<T>> out, Compare c = {}, WorkerPool* pool = nullptr)
+{
+  using R = quantile_t<T>;
+  const std::size_t nq = qs.size();
+  if (nq == 0) return;
+
+  // Quantiles triés par rang croissant, pour que chaque sélection réduise la suivante
+  std::vector<std::size_t> order(nq);
+  for (std::size_t k = 0; k < nq; ++k) order[k] = k;
+  std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) { return qs[a] < qs[b]; });
+
+  detail::for_each_segment(pool, group_offsets, [&](std::size_t g) {
+    const auto first = values.begin() + group_offsets[g];
+    const std::size_t n = group_offsets[g + 1] - group_offsets[g];
+    R* row = out.data() + g * nq;
+    if (n == 0)
+    {
+      for (std::size_t k = 0; k < nq; ++k) row[k] = std::numeric_limits<R>::quiet_NaN();
+      return;
+    }
+
+    const bool sorted = n <= detail::kQuantileSortMax;
+    if (sorted) sort_small(first, first + n, c);
+    std::size_t selected = 0;  // [first, first + selected) est déjà en place
+    for (std::size_t k : order)
+    {
+      const double h = std::clamp(qs[k], 0.0, 1.0) * static_cast<double>(n - 1);
+      const std::size_t lo = std::min(static_cast<std::size_t>(h), n - 1);
+      const R frac = static_cast<R>(h - static_cast<double>(lo));
+      if (!sorted && lo >= selected)
+      {
+        network_select(first + selected, first + lo, first + n, c);
+        selected = lo + 1;
+      }
+      const R a = static_cast<R>(first[lo]);
+      if (frac == R(0) || lo + 1 == n)
+      {
+        row[k] = a;
+        continue;
+      }
+      // Statistique suivante : le minimum de la partie supérieure, sans réordonner
+      const R b = static_cast<R>(sorted ? first[lo + 1] : *std::min_element(first + lo + 1, first + n, c));
+      row[k] = a + (b - a) * frac;
+    }
+  });
+}
+
+// Matrice groupes x quantiles, en lignes
+template<class T, std::strict_weak_order<T&, T&> Compare = detail::DefaultLess>
+std::vector<quantile_t<T>> grouped_quantiles(std::span<T> values, std::span<const std::size_t> group_offsets,
+                                             std::span<const double> qs, Compare c = {}, WorkerPool* pool = nullptr)
+{
+  std::vector<quantile_t<T>> out(group_offsets.empty() ? 0 : (group_offsets.size() - 1) * qs.size());
+  grouped_quantiles(values, group_offsets, qs, std::span<quantile_t<T>>(out), c, pool);
+  return out;
+}
+
+// grouped_quantiles(values, offsets, {0.5, 0.9, 0.99})
+template<class T, std::strict_weak_order<T&, T&> Compare = detail::DefaultLess>
+std::vector<quantile_t<T>> grouped_quantiles(std::span<T> values, std::span<const std::size_t> group_offsets,
+                                             std::initializer_list<double> qs, Compare c = {}, WorkerPool* pool = nullptr)
+{
+  return grouped_quantiles(values, group_offsets, std::span<const double>(qs.begin(), qs.size()), c, pool);
+}
+
+namespace detail
+{
+  inline constexpr unsigned kTopkNetworkMax = 16;  // groupes courts : réseau partiel de la longueur exacte
+
+  // StaticPartialSort<n, K> pour n dans (K, kTopkNetworkMax], choisi à l'exécution
+  template<unsigned K, class T, class C, unsigned... I>
+  void partial_sort_n(T* a, unsigned n, C& c, std::integer_sequence<unsigned, I...>)
+  {
+    ((n == K + 1 + I ? (StaticPartialSort<K + 1 + I, K>()(a, a + K + 1 + I, c), true) : false) || ...);
+  }
+
+  // Top K de [first, first + n), n > K, dans best[0..K)
+  template<unsigned K, class T, class It, class C>
+  void chunked_topk(It first, std::size_t n, T* best, C& c)
+  {
+    TopKBuffer<K, T, C&> top(c);
+    for (std::size_t i = 0; i < n; ++i) top.push(first[i]);
+    top.flush();
+    std::copy(top.data(), top.data() + K, best);
+  }
+}
+
+/**
+ * The K best (smallest under `c`) elements of every group
+ * [offsets[g], offsets[g + 1]) of `values`, in order: out[g * K + i] is the
+ * i-th best of group g, for i < min(K, group length); the remaining slots of
+ * shorter groups are left untouched. `values` is not modified.
+ *
+ * Groups of at most K elements are sorted whole, groups of at most 16 by the
+ * StaticPartialSort network of their exact length, and longer groups by
+ * chunked candidate filtering with network merges (StaticMultiMerge<2, K, K>).
+ * Groups are processed in parallel on `pool`, by runs of about the same
+ * number of elements. Ties between equal elements are broken arbitrarily.
+ * \tparam K  The number of elements kept per group.
+ */
+template<unsigned K, class T, std::strict_weak_order<std::remove_const_t<T>&, std::remove_const_t<T>&> Compare = detail::DefaultLess>
+  requires (K >= 1)
+void segmented_topk(std::span<T> values, std::span<const std::size_t> offsets, std::span<std::remove_const_t<T>> out,
+                    Compare c = {}, WorkerPool* pool = nullptr)
+{
+  using V = std::remove_const_t<T>;
+  detail::for_each_segment(pool, offsets, [&](std::size_t g) {
+    const auto first = values.begin() + offsets[g];
+    const std::size_t n = offsets[g + 1] - offsets[g];
+    V* row = out.data() + g * K;
+    if (n <= K)
+    {
+      std::copy(first, first + n, row);
+      sort_small(row, row + n, c);
+    }
+    else if (n <= detail::kTopkNetworkMax)
+    {
+      std::array<V, detail::kTopkNetworkMax> a;
+      std::copy(first, first + n, a.begin());
+      if constexpr (K < detail::kTopkNetworkMax)
+        detail::partial_sort_n<K>(a.data(), static_cast<unsigned>(n), c,
+                                  std::make_integer_sequence<unsigned, detail::kTopkNetworkMax - K>());
+      std::copy(a.begin(), a.begin() + K, row);
+    }
+    else detail::chunked_topk<K>(first, n, row, c);
+  });
+}
+
+// Matrice groupes x K, en lignes
+template<unsigned K, class T, std::strict_weak_order<std::remove_const_t<T>&, std::remove_const_t<T>&> Compare = detail::DefaultLess>
+  requires (K >= 1)
+std::vector<std::remove_const_t<T>> segmented_topk(std::span<T> values, std::span<const std::size_t> offsets,
+                                                   Compare c = {}, WorkerPool* pool = nullptr)
+{
+  std::vector<std::remove_const_t<T>> out(offsets.empty() ? 0 : (offsets.size() - 1) * K);
+  segmented_topk<K>(values, offsets, std::span<std::remove_const_t<T>>(out), c, pool);
+  return out;
+}
+
+#endif
@@ -0,0 +1,256 @@
+#ifndef static_sort_queue_h
+#define static_sort_queue_h
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "static_sort_engines.h"
+
+// Organisation des clés d'une StaticPriorityQueue
+enum class QueuePolicy
+{
+  Sorted,   // triées : pop_min en O(1), insertion par décalage, lots fusionnés
+  Unsorted  // en vrac : push en O(1), pop_min par minimum vectoriel
+};
+
+/**
+ * Fixed-capacity min-priority queue of (key, value) pairs for small pending
+ * sets (16 to 64 items), stored in two flat arrays instead of a heap.
+ *
+ * - QueuePolicy::Sorted keeps the keys in decreasing order, the minimum
+ *   last: pop_min() is O(1), push() counts the larger keys in vector lanes
+ *   (the free slots hold the smallest key) and shifts them, bulk_push()
+ *   sorts the batch with the network of its exact length (up to 16 items)
+ *   and merges it from the back. Equal keys pop in insertion order.
+ * - QueuePolicy::Unsorted appends on push(); pop_min() takes the minimum of
+ *   the whole key array in vector lanes, each lane carrying the slot of its
+ *   minimum (the free slots hold the largest key), and moves the last item
+ *   into that slot.
+ *
+ * The sorted policy suits queues popped more often than filled, the
+ * unsorted one queues filled in bursts. decrease_key() finds an item by
+ * value. Keys must not be NaN.
+ * \tparam N  The capacity.
+ */
+template<unsigned N, class Key, class Value = std::uint32_t, QueuePolicy Policy = QueuePolicy::Unsorted>
+  requires (N >= 1) && std::is_arithmetic_v<Key> && (!std::is_same_v<Key, bool>) && (sizeof(Key) <= 8) &&
+           (sizeof(Key) > 1 || N <= 128) && std::is_default_constructible_v<Value>
+class StaticPriorityQueue
+{
+  static constexpr std::size_t W = 32 / sizeof(Key);  // clés par registre AVX2
+  static constexpr std::size_t Slots = (N + W - 1) / W * W;
+  // Places libres : jamais plus grandes (tri décroissant) ni plus petites (minimum) qu'une clé, infinis compris
+  static constexpr Key kLowest = std::numeric_limits<Key>::has_infinity ? -std::numeric_limits<Key>::infinity()
+                                                                        : std::numeric_limits<Key>::lowest();
+  static constexpr Key kHighest = std::numeric_limits<Key>::has_infinity ? std::numeric_limits<Key>::infinity()
+                                                                         : std::numeric_limits<Key>::max();
+  static constexpr Key kFree = Policy == QueuePolicy::Sorted ? kLowest : kHighest;
+  // Rangs et compteurs de la largeur des clés, pour les sélections voie par voie
+  using Rank = std::conditional_t<sizeof(Key) == 1, std::int8_t,
+               std::conditional_t<sizeof(Key) == 2, std::int16_t,
+               std::conditional_t<sizeof(Key) == 4, std::int32_t, std::int64_t>>>;
+  using Lane = detail::Lanes<Key, W>;
+  using Index = detail::Lanes<Rank, W>;
+
+public:
+  static constexpr unsigned capacity = N;
+
+  StaticPriorityQueue() noexcept { keys_.fill(kFree); }
+
+  unsigned size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+  bool full() const noexcept { return size_ == N; }
+
+  // Plus petite clé et sa valeur ; la file ne doit pas être vide
+  std::pair<Key, Value> top() const
+  {
+    const unsigned i = min_index();
+    return {keys_[i], values_[i]};
+  }
+
+  // Faux si la file est pleine
+  bool push(Key key, const Value& value)
+  {
+    if (size_ == N) return false;
+    if constexpr (Policy == QueuePolicy::Sorted)
+    {
+      const unsigned pos = larger_than(key);
+      std::copy_backward(keys_.begin() + pos, keys_.begin() + size_, keys_.begin() + size_ + 1);
+      std::copy_backward(values_.begin() + pos, values_.begin() + size_, values_.begin() + size_ + 1);
+      keys_[pos] = key;
+      values_[pos] = value;
+    }
+    else
+    {
+      keys_[size_] = key;
+      values_[size_] = value;
+    }
+    ++size_;
+    return true;
+  }
+
+  // Retire et renvoie la plus petite clé et sa valeur ; la file ne doit pas être vide
+  std::pair<Key, Value> pop_min()
+  {
+    const unsigned i = min_index();
+    std::pair<Key, Value> top{keys_[i], std::move(values_[i])};
+    --size_;
+    if (Policy == QueuePolicy::Unsorted && i != size_)
+    {
+      keys_[i] = keys_[size_];
+      values_[i] = std::move(values_[size_]);
+    }
+    keys_[size_] = kFree;
+    return top;
+  }
+
+  /**
+   * Lowers the key of the first item holding `value` to `key`. Returns
+   * false, and changes nothing, if no item holds `value` or if `key` is not
+   * smaller than its current key.
+   */
+  bool decrease_key(const Value& value, Key key)
+    requires std::equality_comparable<Value>
+  {
+    const unsigned i = static_cast<unsigned>(std::find(values_.begin(), values_.begin() + size_, value) - values_.begin());
+    if (i == size_ || !(key < keys_[i])) return false;
+    if constexpr (Policy == QueuePolicy::Sorted)
+    {
+      // La clé baisse : l'élément recule vers la fin, derrière les clés plus grandes
+      unsigned j = i;
+      while (j + 1 < size_ && key < keys_[j + 1]) ++j;
+      Value v = std::move(values_[i]);
+      std::copy(keys_.begin() + i + 1, keys_.begin() + j + 1, keys_.begin() + i);
+      std::move(values_.begin() + i + 1, values_.begin() + j + 1, values_.begin() + i);
+      keys_[j] = key;
+      values_[j] = std::move(v);
+    }
+    else keys_[i] = key;
+    return true;
+  }
+
+  /**
+   * Inserts the pairs (keys[i], values[i]) while there is room and returns
+   * how many were inserted.
+   */
+  std::size_t bulk_push(std::span<const Key> keys, std::span<const Value> values)
+  {
+    const unsigned m = static_cast<unsigned>(std::min<std::size_t>({keys.size(), values.size(), N - size_}));
+    if constexpr (Policy == QueuePolicy::Sorted)
+    {
+      // Lot trié par clé décroissante (réseau de la longueur exacte jusqu'à 16), puis fusion depuis la fin
+      std::array<std::pair<Key, unsigned>, N> batch;
+      for (unsigned k = 0; k < m; ++k) batch[k] = {keys[k], k};
+      sort_small(batch.begin(), batch.begin() + m, [](const auto& a, const auto& b) { return b < a; });
+      unsigned i = size_, j = m, out = size_ + m;
+      while (j > 0)
+      {
+        --out;
+        // À clé égale l'élément déjà présent reste plus près de la fin : il sort d'abord
+        if (i > 0 && !(batch[j - 1].first < keys_[i - 1]))
+        {
+          --i;
+          keys_[out] = keys_[i];
+          values_[out] = std::move(values_[i]);
+        }
+        else
+        {
+          --j;
+          keys_[out] = batch[j].first;
+          values_[out] = values[batch[j].second];
+        }
+      }
+    }
+    else
+    {
+      std::copy_n(keys.begin(), m, keys_.begin() + size_);
+      std::copy_n(values.begin(), m, values_.begin() + size_);
+    }
+    size_ += m;
+    return m;
+  }
+
+  void clear() noexcept
+  {
+    keys_.fill(kFree);
+    size_ = 0;
+  }
+
+private:
+  Lane load(std::size_t b) const noexcept
+  {
+    Lane x;
+    std::memcpy(&x.v, keys_.data() + b, sizeof(x.v));
+    return x;
+  }
+
+  // Clés strictement plus grandes que key : position d'insertion dans l'ordre décroissant
+  unsigned larger_than(Key key) const noexcept
+  {
+    Index count{};
+    for (std::size_t b = 0; b < Slots; b += W)
+    {
+      const Lane x = load(b);
+#if defined(__GNUC__) || defined(__clang__)
+      count.v -= key < x.v;  // vrai vaut -1 dans une voie
+#else
+      for (std::size_t k = 0; k < W; ++k) count.v[k] += key < x.v[k];
+#endif
+    }
+    unsigned n = 0;
+    for (std::size_t k = 0; k < W; ++k) n += static_cast<unsigned>(count.v[k]);
+    return n;
+  }
+
+  unsigned min_index() const noexcept
+  {
+    if constexpr (Policy == QueuePolicy::Sorted) return size_ - 1;
+    else
+    {
+      // Minimum vertical sur les registres de W clés, chaque voie gardant le rang de son minimum
+      Lane lo = load(0);
+      Index at, rank;
+      for (std::size_t k = 0; k < W; ++k) at.v[k] = rank.v[k] = static_cast<Rank>(k);
+      for (std::size_t b = W; b < Slots; b += W)
+      {
+        const Lane x = load(b);
+#if defined(__GNUC__) || defined(__clang__)
+        rank.v += static_cast<Rank>(W);
+        const auto lt = x.v < lo.v;
+        lo.v = lt ? x.v : lo.v;
+        at.v = lt ? rank.v : at.v;
+#else
+        for (std::size_t k = 0; k < W; ++k)
+        {
+          rank.v[k] += static_cast<Rank>(W);
+          if (x.v[k] < lo.v[k]) { lo.v[k] = x.v[k]; at.v[k] = rank.v[k]; }
+        }
+#endif
+      }
+      // Puis horizontal ; à clé égale le plus petit rang, donc une place occupée
+      Key m = lo.v[0];
+      Rank i = at.v[0];
+      for (std::size_t k = 1; k < W; ++k)
+      {
+        const bool take = lo.v[k] < m || (lo.v[k] == m && at.v[k] < i);
+        m = take ? lo.v[k] : m;
+        i = take ? at.v[k] : i;
+      }
+      return static_cast<unsigned>(i);
+    }
+  }
+
+  alignas(32) std::array<Key, Slots> keys_;
+  std::array<Value, N> values_{};
+  unsigned size_ = 0;
+};
+
+#endif
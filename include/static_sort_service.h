@@ -0,0 +1,321 @@
+#ifndef static_sort_service_h
+#define static_sort_service_h
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <semaphore>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include "static_sort_engines.h"
+
+namespace detail
+{
+  /**
+   * Bounded lock-free multi-producer multi-consumer ring (D. Vyukov): every
+   * cell carries a sequence number telling whether it is ready to be written
+   * or read at a given lap, so producers and consumers only contend on their
+   * own cursor.
+   */
+  template<class T>
+  class MpmcRing
+  {
+  public:
+    explicit MpmcRing(std::size_t capacity)
+      : mask_(std::bit_ceil(std::max<std::size_t>(capacity, 2)) - 1), cells_(new Cell[mask_ + 1])
+    {
+      for (std::size_t i = 0; i <= mask_; ++i) cells_[i].seq.store(i, std::memory_order_relaxed);
+    }
+
+    bool try_push(const T& value) noexcept
+    {
+      std::size_t pos = tail_.load(std::memory_order_relaxed);
+      for (;;)
+      {
+        Cell& c = cells_[pos & mask_];
+        const std::size_t seq = c.seq.load(std::memory_order_acquire);
+        const auto diff = static_cast<std::ptrdiff_t>(seq - pos);
+        if (diff == 0)
+        {
+          if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+          {
+            c.value = value;
+            c.seq.store(pos + 1, std::memory_order_release);
+            return true;
+          }
+        }
+        else if (diff < 0) return false;  // pleine
+        else pos = tail_.load(std::memory_order_relaxed);
+      }
+    }
+
+    bool try_pop(T& value) noexcept
+    {
+      std::size_t pos = head_.load(std::memory_order_relaxed);
+      for (;;)
+      {
+        Cell& c = cells_[pos & mask_];
+        const std::size_t seq = c.seq.load(std::memory_order_acquire);
+        const auto diff = static_cast<std::ptrdiff_t>(seq - (pos + 1));
+        if (diff == 0)
+        {
+          if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+          {
+            value = c.value;
+            c.seq.store(pos + mask_ + 1, std::memory_order_release);
+            return true;
+          }
+        }
+        else if (diff < 0) return false;  // vide (ou cellule en cours d'écriture)
+        else pos = head_.load(std::memory_order_relaxed);
+      }
+    }
+
+  private:
+    struct alignas(64) Cell
+    {
+      std::atomic<std::size_t> seq;
+      T value;
+    };
+
+    std::size_t mask_;
+    std::unique_ptr<Cell[]> cells_;
+    alignas(64) std::atomic<std::size_t> head_{0};
+    alignas(64) std::atomic<std::size_t> tail_{0};
+  };
+}
+
+/**
+ * In-process sorting service: a fixed set of worker threads fed through a
+ * lock-free submission ring. Callers hand over batches of fixed-size arrays
+ * or whole ranges and get a std::future or a completion callback.
+ *
+ * When a worker wakes up it also takes the submissions already waiting in the
+ * ring (up to kMaxCoalesce) and sorts the arrays of all the small batches of
+ * the same size and type together with StaticBatchSort, so that many requests
+ * of a few arrays each still fill complete vector lanes.
+ *
+ * Submitted data must stay alive and untouched until completion. If the ring
+ * is full, the submitting thread sorts its data itself. Callbacks run on a
+ * worker thread and must not throw; with a callback, an exception from a
+ * range comparator terminates. The destructor completes every pending
+ * submission.
+ */
+class SortService
+{
+public:
+  static constexpr std::size_t kMaxCoalesce = 64;
+
+  explicit SortService(unsigned threads = std::max(1u, std::thread::hardware_concurrency()),
+                       std::size_t queue_capacity = 1024)
+    : ring_(queue_capacity)
+  {
+    threads = std::max(1u, threads);
+    workers_.reserve(threads);
+    for (unsigned i = 0; i < threads; ++i) workers_.emplace_back([this] { work(); });
+  }
+
+  SortService(const SortService&) = delete;
+  SortService& operator=(const SortService&) = delete;
+
+  ~SortService()
+  {
+    stop_.store(true, std::memory_order_release);
+    items_.release(static_cast<std::ptrdiff_t>(workers_.size()));
+    for (auto& t : workers_) t.join();
+  }
+
+  // Trie chacun des tableaux de `arrays`
+  template<detail::BatchElement T, std::size_t N>
+  std::future<void> submit(std::span<std::array<T, N>> arrays)
+  {
+    auto job = make_batch_job(arrays);
+    auto f = job->promise.get_future();
+    enqueue(job.release());
+    return f;
+  }
+
+  template<detail::BatchElement T, std::size_t N, std::invocable F>
+  void submit(std::span<std::array<T, N>> arrays, F&& on_done)
+  {
+    auto job = make_batch_job(arrays);
+    job->callback = std::forward<F>(on_done);
+    enqueue(job.release());
+  }
+
+  // Trie une plage entière (hybrid_sort) ; une exception du comparateur est transmise au future
+  template<class T, std::strict_weak_order<T&, T&> Compare = detail::DefaultLess>
+  std::future<void> submit_range(std::span<T> range, Compare c = {})
+  {
+    auto job = make_range_job(range, c);
+    auto f = job->promise.get_future();
+    enqueue(job.release());
+    return f;
+  }
+
+  template<class T, std::invocable F, class Compare = detail::DefaultLess>
+  void submit_range(std::span<T> range, F&& on_done, Compare c = {})
+  {
+    auto job = make_range_job(range, c);
+    job->callback = std::forward<F>(on_done);
+    enqueue(job.release());
+  }
+
+  unsigned size() const noexcept { return static_cast<unsigned>(workers_.size()); }
+
+private:
+  struct Job
+  {
+    // Noyau commun aux jobs coalescibles : même pointeur <=> même (N, T)
+    void (*kernel)(Job* const* jobs, std::size_t n) = nullptr;
+    void* data = nullptr;
+    std::size_t count = 0;
+    std::function<void()> work;  // jobs de plage
+    std::exception_ptr error;
+    std::promise<void> promise;
+    std::function<void()> callback;
+
+    void complete() noexcept
+    {
+      if (callback)
+      {
+        if (error) std::terminate();  // pas de canal d'erreur sans future
+        callback();
+      }
+      else if (error) promise.set_exception(error);
+      else promise.set_value();
+    }
+  };
+
+  template<unsigned N, class T>
+  static void batch_kernel(Job* const* jobs, std::size_t n) noexcept
+  {
+    constexpr std::size_t W = StaticBatchSort<N>::template lanes<T>;
+    // Tableaux des petits jobs regroupés pour remplir les voies
+    std::array<T*, 256> rows;
+    std::size_t k = 0;
+    for (std::size_t j = 0; j < n; ++j)
+    {
+      T* data = static_cast<T*>(jobs[j]->data);
+      const std::size_t count = jobs[j]->count;
+      if (count >= W)
+      {
+        StaticBatchSort<N>()(data, count);
+        continue;
+      }
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        rows[k++] = data + i * N;
+        if (k == rows.size()) { StaticBatchSort<N>()(rows.data(), k); k = 0; }
+      }
+    }
+    StaticBatchSort<N>()(rows.data(), k);
+  }
+
+  static void range_kernel(Job* const* jobs, std::size_t n) noexcept
+  {
+    for (std::size_t j = 0; j < n; ++j)
+    {
+      try { jobs[j]->work(); }
+      catch (...) { jobs[j]->error = std::current_exception(); }
+    }
+  }
+
+  template<class T, std::size_t N>
+  static std::unique_ptr<Job> make_batch_job(std::span<std::array<T, N>> arrays)
+  {
+    static_assert(sizeof(std::array<T, N>) == N * sizeof(T));
+    auto job = std::make_unique<Job>();
+    job->kernel = &batch_kernel<static_cast<unsigned>(N), T>;
+    job->data = arrays.data();  // std::array<T, N> : N éléments contigus, sans bourrage
+    job->count = arrays.size();
+    return job;
+  }
+
+  template<class T, class Compare>
+  static std::unique_ptr<Job> make_range_job(std::span<T> range, Compare c)
+  {
+    auto job = std::make_unique<Job>();
+    job->kernel = &range_kernel;
+    job->work = [range, c] { hybrid_sort(range.begin(), range.end(), c); };
+    return job;
+  }
+
+  void enqueue(Job* job)
+  {
+    if (ring_.try_push(job))
+    {
+      items_.release();
+      return;
+    }
+    // File pleine : l'appelant trie lui-même
+    job->kernel(&job, 1);
+    job->complete();
+    delete job;
+  }
+
+  // Chaque jeton du sémaphore correspond à un job publié, sauf les jetons d'arrêt
+  bool pop(Job*& job) noexcept
+  {
+    while (!ring_.try_pop(job))
+    {
+      if (stop_.load(std::memory_order_acquire)) return false;
+      std::this_thread::yield();  // publication en cours d'une cellule précédente
+    }
+    return true;
+  }
+
+  void work() noexcept
+  {
+    std::array<Job*, kMaxCoalesce> jobs;
+    std::array<Job*, kMaxCoalesce> group;
+    for (;;)
+    {
+      items_.acquire();
+      if (!pop(jobs[0])) return;
+      std::size_t n = 1;
+      while (n < kMaxCoalesce && items_.try_acquire())
+      {
+        if (!pop(jobs[n]))
+        {
+          items_.release();  // jeton d'arrêt : rendu pour un autre worker
+          break;
+        }
+        ++n;
+      }
+
+      // Regroupement par noyau, dans l'ordre d'arrivée
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        if (!jobs[i]) continue;
+        std::size_t m = 0;
+        for (std::size_t j = i; j < n; ++j)
+          if (jobs[j] && jobs[j]->kernel == jobs[i]->kernel) { group[m++] = jobs[j]; if (j != i) jobs[j] = nullptr; }
+        group[0]->kernel(group.data(), m);
+        for (std::size_t j = 0; j < m; ++j)
+        {
+          group[j]->complete();
+          delete group[j];
+        }
+        jobs[i] = nullptr;
+      }
+    }
+  }
+
+  detail::MpmcRing<Job*> ring_;
+  std::counting_semaphore<> items_{0};
+  std::atomic<bool> stop_{false};
+  std::vector<std::thread> workers_;
+};
+
+#endif
@@ -0,0 +1,132 @@
+#ifndef static_sort_sparse_h
+#define static_sort_sparse_h
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+#include "static_sort_engines.h"
+#include "static_sort_parallel.h"
+
+/**
+ * Compressed sparse row matrix: the column indices and values of row r are
+ * col_idx[row_ptr[r] .. row_ptr[r + 1]) and values[...], sorted by column.
+ */
+template<class T>
+struct CsrMatrix
+{
+  std::size_t rows = 0;
+  std::size_t cols = 0;
+  std::vector<std::uint32_t> row_ptr;
+  std::vector<std::uint32_t> col_idx;
+  std::vector<T> values;
+};
+
+namespace detail
+{
+  inline constexpr std::size_t kCsrMinChunk = 1 << 16;  // triplets minimum par tâche de comptage
+  inline constexpr std::size_t kCsrRowBlock = 1024;  // lignes par tâche de tri
+}
+
+/**
+ * Converts coordinate-format triplets (row_idx[i], col_idx[i], values[i])
+ * to CSR.
+ *
+ * A counting pass builds per-chunk row histograms, the triplets are scattered
+ * into their rows as packed (col << 32 | scatter position) keys, and every row is
+ * sorted by those keys: rows of at most 16 entries with the sorting network
+ * of their exact length, longer rows with hybrid_sort(). All three passes run
+ * in parallel on `pool` when one is given.
+ *
+ * Duplicate (row, col) entries are kept, in input order. At most 2^32 - 1
+ * triplets. The histograms and the scattered triplets are taken from `mr`
+ * by the calling thread.
+ */
+template<class T>
+CsrMatrix<T> coo_to_csr(std::size_t rows, std::size_t cols, std::span<const std::uint32_t> row_idx,
+                        std::span<const std::uint32_t> col_idx, std::span<const T> values, WorkerPool* pool = nullptr,
+                        std::pmr::memory_resource* mr = std::pmr::get_default_resource())
+{
+  const std::size_t nnz = row_idx.size();
+  CsrMatrix<T> m;
+  m.rows = rows;
+  m.cols = cols;
+  m.row_ptr.assign(rows + 1, 0);
+  m.col_idx.resize(nnz);
+  m.values.resize(nnz);
+
+  // Un histogramme de lignes par worker : la mémoire reste en O(workers * rows)
+  const std::size_t workers = pool ? pool->size() : 1;
+  const std::size_t chunks = std::clamp<std::size_t>(nnz / detail::kCsrMinChunk, 1, workers);
+  const std::size_t chunk = (nnz + chunks - 1) / chunks;
+  std::pmr::vector<std::uint32_t> offsets(chunks * rows, 0, mr);
+  detail::parallel_for(pool, chunks, [&](std::size_t c, unsigned) {
+    std::uint32_t* h = offsets.data() + c * rows;
+    const std::size_t end = std::min(nnz, (c + 1) * chunk);
+    for (std::size_t i = c * chunk; i < end; ++i) ++h[row_idx[i]];
+  });
+
+  std::uint32_t total = 0;
+  for (std::size_t r = 0; r < rows; ++r)
+  {
+    m.row_ptr[r] = total;
+    for (std::size_t c = 0; c < chunks; ++c)
+    {
+      const std::uint32_t count = offsets[c * rows + r];
+      offsets[c * rows + r] = total;
+      total += count;
+    }
+  }
+  m.row_ptr[rows] = total;
+
+  // Dispersion : l'ordre d'entrée est conservé dans chaque ligne. Clé et valeur
+  // partagent une entrée (un seul défaut de cache par triplet) ; la clé porte la
+  // position de dispersion, si bien que la relecture des valeurs reste locale à la ligne
+  struct Entry
+  {
+    std::uint64_t key;
+    T value;
+  };
+  std::pmr::vector<Entry> scattered(nnz, mr);
+  detail::parallel_for(pool, chunks, [&](std::size_t c, unsigned) {
+    std::uint32_t* pos = offsets.data() + c * rows;
+    const std::size_t end = std::min(nnz, (c + 1) * chunk);
+    for (std::size_t i = c * chunk; i < end; ++i)
+    {
+      const std::uint32_t p = pos[row_idx[i]]++;
+      scattered[p] = {(std::uint64_t(col_idx[i]) << 32) | p, values[i]};
+    }
+  });
+
+  const std::size_t blocks = (rows + detail::kCsrRowBlock - 1) / detail::kCsrRowBlock;
+  std::vector<std::vector<std::uint64_t>> long_rows(workers);
+  detail::parallel_for(pool, blocks, [&](std::size_t b, unsigned worker) {
+    const std::size_t last = std::min(rows, (b + 1) * detail::kCsrRowBlock);
+    std::array<std::uint64_t, detail::kNetworkLeaf> local;
+    for (std::size_t r = b * detail::kCsrRowBlock; r < last; ++r)
+    {
+      const std::size_t begin = m.row_ptr[r];
+      const std::size_t len = m.row_ptr[r + 1] - begin;
+      std::uint64_t* keys = local.data();
+      if (len > detail::kNetworkLeaf)
+      {
+        long_rows[worker].resize(len);
+        keys = long_rows[worker].data();
+      }
+      for (std::size_t k = 0; k < len; ++k) keys[k] = scattered[begin + k].key;
+      sort_small(keys, keys + len);  // réseau pour les lignes courtes, hybrid_sort au-delà
+      for (std::size_t k = 0; k < len; ++k)
+      {
+        m.col_idx[begin + k] = static_cast<std::uint32_t>(keys[k] >> 32);
+        m.values[begin + k] = scattered[static_cast<std::uint32_t>(keys[k])].value;
+      }
+    }
+  });
+  return m;
+}
+
+#endif
@@ -0,0 +1,192 @@
+#ifndef static_sort_stats_h
+#define static_sort_stats_h
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+#include "static_sort.h"
+
+namespace detail
+{
+  // Rangs [lo, hi) demandés
+  template<unsigned N>
+  consteval NetworkOutputs<N> outputs_between(unsigned lo, unsigned hi)
+  {
+    NetworkOutputs<N> o;
+    for (unsigned i = lo; i < hi && i < N; ++i) o.used[i] = true;
+    return o;
+  }
+}
+
+/**
+ * Robust statistics over many groups of NumElements floating-point values:
+ * median, median absolute deviation, interquartile range and trimmed mean.
+ *
+ * Like StaticBatchSort, W groups (one vector register of T) are transposed so
+ * that element i of the W groups shares a Lanes<T, W>, and every comparator
+ * works on all of them at once. Instead of the full sorting network each
+ * statistic runs a selection network (StaticSelect) reduced to the ranks it
+ * reads: the MAD of 25 values costs two 113-comparator selections instead of
+ * two 154-comparator sorts. The last, incomplete group of W is padded with
+ * copies of its final group; only the valid results are written.
+ *
+ * Groups are contiguous: values[g * NumElements + i] is element i of group g,
+ * and out[g] receives the statistic of group g. Values must not be NaN.
+ * \tparam NumElements  The number of values in each group.
+ */
+template<unsigned NumElements>
+  requires (NumElements >= 1)
+class StaticGroupStats
+{
+  static constexpr unsigned N = NumElements;
+
+public:
+  template<class T>
+  static constexpr std::size_t lanes = StaticBatchSort<N>::template lanes<T>;
+
+  // Médiane ; moyenne des deux valeurs centrales pour N pair
+  template<std::floating_point T>
+  void median(const T* values, std::size_t groups, T* out) const noexcept
+  {
+    run(values, groups, out, [](auto& block) { return median_of(block); });
+  }
+
+  // Écart absolu médian, non normalisé (multiplier par 1.4826 pour estimer l'écart type d'une loi normale)
+  template<std::floating_point T>
+  void mad(const T* values, std::size_t groups, T* out) const noexcept
+  {
+    run(values, groups, out, [](auto& block)
+    {
+      const auto m = median_of(block);  // la sélection ne fait que permuter le groupe
+      for (unsigned i = 0; i < N; ++i) block[i] = abs_diff(block[i], m);
+      return median_of(block);
+    });
+  }
+
+  // Écart interquartile, quantiles interpolés linéairement (type 7 de Hyndman-Fan, celui de R et NumPy)
+  template<std::floating_point T>
+  void iqr(const T* values, std::size_t groups, T* out) const noexcept
+  {
+    run(values, groups, out, [](auto& block)
+    {
+      constexpr unsigned q1 = (N - 1) / 4, q3 = 3 * (N - 1) / 4;
+      StaticSelect<N, q1, std::min(q1 + 1, N - 1), q3, std::min(q3 + 1, N - 1)>()(block);
+      using L = std::remove_reference_t<decltype(block[0])>;
+      const L lo = lerp(block[q1], block[std::min(q1 + 1, N - 1)], T((N - 1) % 4) / 4);
+      const L hi = lerp(block[q3], block[std::min(q3 + 1, N - 1)], T(3 * (N - 1) % 4) / 4);
+      return sub(hi, lo);
+    });
+  }
+
+  // Moyenne après retrait des Trim plus petites et des Trim plus grandes valeurs de chaque groupe
+  template<unsigned Trim, std::floating_point T>
+    requires (2 * Trim < NumElements)
+  void trimmed_mean(const T* values, std::size_t groups, T* out) const noexcept
+  {
+    run(values, groups, out, [](auto& block)
+    {
+      // Les valeurs centrales sont sommées à leur rang exact : une valeur aberrante écartée n'entre jamais dans la somme
+      if constexpr (Trim > 0) detail::SelectionNetwork<N, detail::outputs_between<N>(Trim, N - Trim)>()(block);
+      auto sum = block[Trim];
+      for (unsigned i = Trim + 1; i < N - Trim; ++i) sum = add(sum, block[i]);
+      return scale(sum, T(1) / T(N - 2 * Trim));
+    });
+  }
+
+private:
+  template<class T, std::size_t W>
+  static detail::Lanes<T, W> median_of(std::array<detail::Lanes<T, W>, N>& block) noexcept
+  {
+    if constexpr (N % 2)
+    {
+      StaticSelect<N, N / 2>()(block);
+      return block[N / 2];
+    }
+    else
+    {
+      StaticSelect<N, N / 2 - 1, N / 2>()(block);
+      return lerp(block[N / 2 - 1], block[N / 2], T(0.5));
+    }
+  }
+
+  // Opérations voie par voie sur les Lanes
+  template<class L>
+  static L add(const L& a, const L& b) noexcept
+  {
+    L r;
+#if defined(__GNUC__) || defined(__clang__)
+    r.v = a.v + b.v;
+#else
+    for (std::size_t k = 0; k < std::size(r.v); ++k) r.v[k] = a.v[k] + b.v[k];
+#endif
+    return r;
+  }
+
+  template<class L>
+  static L sub(const L& a, const L& b) noexcept
+  {
+    L r;
+#if defined(__GNUC__) || defined(__clang__)
+    r.v = a.v - b.v;
+#else
+    for (std::size_t k = 0; k < std::size(r.v); ++k) r.v[k] = a.v[k] - b.v[k];
+#endif
+    return r;
+  }
+
+  template<class L, class T>
+  static L scale(const L& a, T s) noexcept
+  {
+    L r;
+#if defined(__GNUC__) || defined(__clang__)
+    r.v = a.v * s;
+#else
+    for (std::size_t k = 0; k < std::size(r.v); ++k) r.v[k] = a.v[k] * s;
+#endif
+    return r;
+  }
+
+  // a + (b - a) * t
+  template<class L, class T>
+  static L lerp(const L& a, const L& b, T t) noexcept
+  {
+    if (t == T(0)) return a;
+    return add(a, scale(sub(b, a), t));
+  }
+
+  template<class L>
+  static L abs_diff(const L& a, const L& b) noexcept
+  {
+    L r;
+#if defined(__GNUC__) || defined(__clang__)
+    const auto d = a.v - b.v;
+    r.v = d < 0 ? -d : d;
+#else
+    for (std::size_t k = 0; k < std::size(r.v); ++k) r.v[k] = a.v[k] < b.v[k] ? b.v[k] - a.v[k] : a.v[k] - b.v[k];
+#endif
+    return r;
+  }
+
+  template<class T, class Kernel>
+  static void run(const T* values, std::size_t groups, T* out, Kernel kernel) noexcept
+  {
+    constexpr std::size_t W = lanes<T>;
+    std::array<detail::Lanes<T, W>, N> block{};
+    for (std::size_t g = 0; g < groups; g += W)
+    {
+      const std::size_t n = std::min(W, groups - g);
+      for (std::size_t k = 0; k < W; ++k)
+      {
+        const T* r = values + (g + std::min(k, n - 1)) * N;
+        for (unsigned i = 0; i < N; ++i) block[i].v[k] = r[i];
+      }
+      const detail::Lanes<T, W> result = kernel(block);
+      for (std::size_t k = 0; k < n; ++k) out[g + k] = result.v[k];
+    }
+  }
+};
+
+#endif
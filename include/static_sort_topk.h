@@ -0,0 +1,174 @@
+#ifndef static_sort_topk_h
+#define static_sort_topk_h
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "static_sort_engines.h"
+
+/**
+ * Top K (the K smallest under `Compare`) of values pushed concurrently by
+ * many threads, without a shared lock.
+ *
+ * Each thread pushes through its own Producer, which keeps a TopKBuffer: a
+ * network-sorted top K plus a chunk of candidates, so that most values cost
+ * one comparison against the local K-th and touch no shared memory. When its
+ * top K changes, the producer publishes it to its own cache line (a slot)
+ * under a sequence lock: the slot is written with relaxed atomic stores
+ * between two increments of a counter, and a reader retries if the counter
+ * moved. Producers never wait, and never contend with each other.
+ *
+ * top() merges the published slots on demand with StaticMultiMerge<2, K, K>,
+ * from any thread. It sees what producers have published: the candidates of
+ * a producer's incomplete chunk become visible on flush() or when the
+ * producer is destroyed.
+ *
+ * T must be trivially copyable; the slots are lock-free when
+ * std::atomic_ref<T> is (values of up to 8 bytes on common targets). Each
+ * producer owns its slot for the lifetime of the aggregator, so
+ * `max_producers` bounds the number of producer() calls.
+ * \tparam K  The number of values kept.
+ */
+template<unsigned K, class T, std::strict_weak_order<T&, T&> Compare = detail::DefaultLess>
+  requires (K >= 1) && std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>
+class ConcurrentTopK
+{
+  struct alignas(std::atomic_ref<T>::required_alignment) Item
+  {
+    T value;
+  };
+
+  struct alignas(64) Slot
+  {
+    std::atomic<std::uint64_t> seq{0};  // impair : publication en cours
+    unsigned size = 0;
+    std::array<Item, K> items{};
+  };
+
+public:
+  explicit ConcurrentTopK(std::size_t max_producers = 4 * std::max(1u, std::thread::hardware_concurrency()),
+                          Compare c = {})
+    : slots_(new Slot[std::max<std::size_t>(max_producers, 1)]), capacity_(std::max<std::size_t>(max_producers, 1)),
+      cmp_(c) {}
+
+  ConcurrentTopK(const ConcurrentTopK&) = delete;
+  ConcurrentTopK& operator=(const ConcurrentTopK&) = delete;
+
+  /**
+   * Per-thread handle: push() from a single thread at a time. The destructor
+   * publishes the pending candidates.
+   */
+  class Producer
+  {
+  public:
+    Producer(Producer&& o) noexcept : slot_(std::exchange(o.slot_, nullptr)), top_(o.top_) {}
+    Producer& operator=(Producer&&) = delete;
+
+    ~Producer()
+    {
+      if (slot_) flush();
+    }
+
+    void push(const T& x)
+    {
+      if (top_.push(x)) publish();
+    }
+
+    // Publie les candidats en attente
+    void flush()
+    {
+      if (top_.flush()) publish();
+    }
+
+  private:
+    friend class ConcurrentTopK;
+
+    Producer(Slot& slot, Compare c) : slot_(&slot), top_(c) {}
+
+    void publish() noexcept
+    {
+      const std::uint64_t s = slot_->seq.load(std::memory_order_relaxed);
+      slot_->seq.store(s + 1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+      const unsigned n = top_.size();
+      for (unsigned k = 0; k < n; ++k)
+        std::atomic_ref<T>(slot_->items[k].value).store(top_.data()[k], std::memory_order_relaxed);
+      std::atomic_ref<unsigned>(slot_->size).store(n, std::memory_order_relaxed);
+      slot_->seq.store(s + 2, std::memory_order_release);
+    }
+
+    Slot* slot_;
+    detail::TopKBuffer<K, T, Compare> top_;
+  };
+
+  // Réserve un emplacement ; std::length_error au-delà de max_producers
+  Producer producer()
+  {
+    const std::size_t i = next_.fetch_add(1, std::memory_order_relaxed);
+    if (i >= capacity_) throw std::length_error("ConcurrentTopK: more producers than max_producers");
+    return Producer(slots_[i], cmp_);
+  }
+
+  // Top K publié, dans l'ordre ; moins de K valeurs si moins ont été poussées
+  std::vector<T> top() const
+  {
+    std::array<T, 2 * K> acc;
+    unsigned have = 0;
+    const std::size_t slots = std::min(next_.load(std::memory_order_relaxed), capacity_);
+    for (std::size_t i = 0; i < slots; ++i)
+    {
+      const unsigned n = read(slots_[i], acc.data() + K);
+      if (n == 0) continue;
+      if (have == K && n == K)
+      {
+        StaticMultiMerge<2, K, K>()(acc, cmp_);
+        continue;
+      }
+      // Emplacement incomplet : fusion scalaire des deux suites triées
+      std::array<T, K> merged;
+      const unsigned total = std::min(K, have + n);
+      unsigned a = 0, b = K;
+      for (unsigned k = 0; k < total; ++k)
+        merged[k] = b < K + n && (a == have || cmp_(acc[b], acc[a])) ? acc[b++] : acc[a++];
+      std::copy(merged.begin(), merged.begin() + total, acc.begin());
+      have = total;
+    }
+    return std::vector<T>(acc.begin(), acc.begin() + have);
+  }
+
+private:
+  // Copie cohérente d'un emplacement : relue tant qu'une publication la traverse
+  static unsigned read(Slot& s, T* out) noexcept
+  {
+    for (;;)
+    {
+      const std::uint64_t before = s.seq.load(std::memory_order_acquire);
+      if (before & 1)
+      {
+        std::this_thread::yield();
+        continue;
+      }
+      const unsigned n = std::atomic_ref<unsigned>(s.size).load(std::memory_order_relaxed);
+      for (unsigned k = 0; k < n; ++k) out[k] = std::atomic_ref<T>(s.items[k].value).load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (s.seq.load(std::memory_order_relaxed) == before) return n;
+    }
+  }
+
+  std::unique_ptr<Slot[]> slots_;
+  std::size_t capacity_;
+  Compare cmp_;
+  alignas(64) std::atomic<std::size_t> next_{0};
+};
+
+#endif
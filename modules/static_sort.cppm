@@ -0,0 +1,90 @@
+/*
+ Named module exporting the header-only library: `import static_sort;`
+ replaces the #include of static_sort.h and of the companion headers. The
+ networks are parsed once, when the module interface is built; importers only
+ read the compiled interface.
+
+ The standard headers are included in the global module fragment so that the
+ library headers, included below in the module purview, only contribute their
+ own declarations. Those are exported with C++ language linkage, which keeps
+ them attached to the global module: a program may mix `import static_sort;`
+ and #include "static_sort.h" in different translation units.
+ Build with -DSTATIC_SORT_BUILD_MODULE=ON (CMake 3.28 or newer).
+ */
+module;
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <future>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <ranges>
+#include <semaphore>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__) || defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+// GCC < 14 échoue (ICE) à écrire une interface contenant un appel d'intrinsèque instancié
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ < 14 && !defined(STATIC_SORT_USE_PDEP)
+#define STATIC_SORT_USE_PDEP 0
+#endif
+
+// GCC < 14 écrit une interface illisible à l'import (« Bad file data ») quand une fonction non générique
+// du purview instancie hybrid_sort, comme sort_encode : le codec s'inclut alors directement
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ < 14
+#define STATIC_SORT_MODULE_CODEC 0
+#else
+#define STATIC_SORT_MODULE_CODEC 1
+#endif
+
+export module static_sort;
+
+export extern "C++"
+{
+#include "static_sort.h"
+#include "static_sort_async.h"
+#if STATIC_SORT_MODULE_CODEC
+#include "static_sort_codec.h"
+#endif
+#include "static_sort_engines.h"
+#include "static_sort_groupby.h"
+#include "static_sort_indirect.h"
+#include "static_sort_lazy.h"
+#include "static_sort_memory.h"
+#include "static_sort_merge.h"
+#include "static_sort_morton.h"
+#include "static_sort_parallel.h"
+#include "static_sort_permute.h"
+#include "static_sort_queue.h"
+#include "static_sort_quantiles.h"
+#include "static_sort_service.h"
+#include "static_sort_sparse.h"
+#include "static_sort_stats.h"
+#include "static_sort_topk.h"
+}
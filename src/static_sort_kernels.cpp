@@ -0,0 +1,30 @@
+#include "static_sort_kernels.h"
+#include "static_sort_c.h"
+#include "static_sort_engines.h"
+
+template<unsigned N, KernelElement T>
+  requires (N >= 2 && N <= 32)
+void sort_kernel(T* data) noexcept
+{
+  StaticSort<N>()(data, data + N);
+}
+
+template<unsigned N, KernelElement T>
+  requires (N >= 2 && N <= 32)
+void sort_kernel_batch(T* data, std::size_t count) noexcept
+{
+  for (std::size_t i = 0; i < count; ++i, data += N) StaticSort<N>()(data, data + N);
+}
+
+// Instanciations explicites et points d'entrée C
+#define SS_DEFINE_SIZE(tag, type, n)                                                           \
+  template void sort_kernel<n, type>(type*) noexcept;                                          \
+  template void sort_kernel_batch<n, type>(type*, std::size_t) noexcept;                       \
+  extern "C" void ss_sort_##tag##_n##n(type* data) { sort_kernel<n>(data); }                   \
+  extern "C" void ss_sort_##tag##_n##n##_batch(type* data, size_t count) { sort_kernel_batch<n>(data, count); }
+
+#define SS_DEFINE_TYPE(tag, type)                                                              \
+  SS_KERNEL_SIZES(SS_DEFINE_SIZE, tag, type)                                                   \
+  extern "C" void ss_sort_##tag(type* data, size_t n) { sort_small(data, data + n); }
+
+SS_KERNEL_TYPES(SS_DEFINE_TYPE)
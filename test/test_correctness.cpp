@@ -1,7 +1,44 @@
 #include <iostream>
 #include <array>
 #include <cassert>
+#include <algorithm>
+#include <string>
+#include <numeric>
+#include <vector>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <future>
+#include <mutex>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <memory_resource>
+#include <functional>
+#include <set>
+#include <map>
+#include <limits>
 #include "../include/static_sort.h"
+#include "../include/static_sort_permute.h"
+#include "../include/static_sort_lazy.h"
+#include "../include/static_sort_merge.h"
+#include "../include/static_sort_morton.h"
+#include "../include/static_sort_sparse.h"
+#include "../include/static_sort_service.h"
+#include "../include/static_sort_async.h"
+#include "../include/static_sort_stats.h"
+#include "../include/static_sort_quantiles.h"
+#include "../include/static_sort_memory.h"
+#include "../include/static_sort_indirect.h"
+#include "../include/static_sort_groupby.h"
+#include "../include/static_sort_codec.h"
+#include "../include/static_sort_topk.h"
+#include "../include/static_sort_queue.h"
+#if defined(STATIC_SORT_KERNELS)
+#include "../include/static_sort_kernels.h"
+#include "../include/static_sort_c.h"
+#endif
 
 // Test helper
 template<typename T, size_t N>
@@ -96,6 +133,957 @@ void test_all_sizes() {
     std::cout << "✓ All sizes tested successfully\n";
 }
 
+void test_strided() {
+    // Colonnes d'une matrice 8x5 (row-major)
+    std::array<int, 40> matrix;
+    for (size_t i = 0; i < matrix.size(); ++i) matrix[i] = static_cast<int>((i * 37) % 41);
+    const auto original = matrix;
+    for (int col = 0; col < 5; ++col) {
+        StaticSort<8>()(&matrix[col], SortStride{5});
+        for (int row = 1; row < 8; ++row) assert(matrix[row * 5 + col] >= matrix[(row - 1) * 5 + col]);
+    }
+    assert(std::is_permutation(matrix.begin(), matrix.end(), original.begin()));
+
+    // Champ d'un tableau de structures, avec comparateur
+    struct Particle { double mass; double depth; };
+    std::array<Particle, 12> particles;
+    for (size_t i = 0; i < particles.size(); ++i) particles[i] = {1.0 * i, static_cast<double>((i * 7) % 12)};
+    StaticSort<12>()(&particles[0].depth, SortStride{2}, [](double a, double b) { return a > b; });
+    for (size_t i = 1; i < particles.size(); ++i) assert(particles[i].depth <= particles[i - 1].depth);
+    assert(particles[3].mass == 3.0);
+
+    std::array<float, 6> small = {3.f, 0.f, 5.f, 1.f, 4.f, 2.f};
+    StaticSort<3>()(small.data(), SortStride{2});
+    assert(small[0] == 3.f && small[2] == 4.f && small[4] == 5.f);
+    std::cout << "✓ Test strided passed\n";
+}
+
+void test_permutation_apply() {
+    const size_t rows = 10007;
+    std::vector<std::uint32_t> perm(rows);
+    std::iota(perm.begin(), perm.end(), 0u);
+    for (size_t i = rows - 1; i > 0; --i) std::swap(perm[i], perm[(i * 7919) % (i + 1)]);
+
+    std::vector<int> a(rows);
+    std::vector<double> b(rows);
+    std::vector<std::uint8_t> c(rows);
+    std::vector<std::array<char, 3>> d(rows);
+    for (size_t i = 0; i < rows; ++i) {
+        a[i] = static_cast<int>(i);
+        b[i] = 0.5 * i;
+        c[i] = static_cast<std::uint8_t>(i);
+        d[i] = {char(i), char(i >> 8), 'x'};
+    }
+
+    WorkerPool pool(3);
+    PermutationApplier applier(rows, 8, &pool);
+    applier.apply(perm, std::span<int>(a), std::span<double>(b), std::span<std::uint8_t>(c), std::span<std::array<char, 3>>(d));
+    for (size_t i = 0; i < rows; ++i) {
+        assert(a[i] == static_cast<int>(perm[i]));
+        assert(b[i] == 0.5 * perm[i]);
+        assert(c[i] == static_cast<std::uint8_t>(perm[i]));
+        assert(d[i][0] == char(perm[i]) && d[i][1] == char(perm[i] >> 8));
+    }
+    std::cout << "✓ Test permutation apply passed\n";
+}
+
+// Données pseudo-aléatoires reproductibles
+static std::vector<int> random_ints(size_t n, int modulo, unsigned seed = 1) {
+    std::vector<int> v(n);
+    unsigned x = seed;
+    for (auto& e : v) {
+        x = x * 1664525u + 1013904223u;
+        e = static_cast<int>((x >> 8) % static_cast<unsigned>(modulo));
+    }
+    return v;
+}
+
+void test_hybrid_sort() {
+    for (size_t n : {0, 1, 2, 15, 16, 17, 100, 5000}) {
+        for (int modulo : {3, 1000000}) {
+            auto v = random_ints(n, modulo);
+            auto expected = v;
+            std::sort(expected.begin(), expected.end());
+            hybrid_sort(v);
+            assert(v == expected);
+
+            auto w = random_ints(n, modulo, 7);
+            hybrid_sort(w.begin(), w.end(), [](int a, int b) { return a > b; });
+            assert(std::is_sorted(w.begin(), w.end(), [](int a, int b) { return a > b; }));
+
+            if (n > 0) {
+                auto s = random_ints(n, modulo, 3);
+                auto ref = s;
+                std::sort(ref.begin(), ref.end());
+                network_select(s.begin(), s.begin() + n / 3, s.end());
+                assert(s[n / 3] == ref[n / 3]);
+            }
+        }
+    }
+    std::cout << "✓ Test hybrid sort passed\n";
+}
+
+void test_lazy_sorted_view() {
+    auto v = random_ints(20000, 1000000);
+    auto expected = v;
+    std::sort(expected.begin(), expected.end());
+
+    lazy_sorted_view view(v);
+    auto it = view.begin();
+    for (int i = 0; i < 10; ++i, ++it) assert(*it == expected[i]);
+    assert(view.sorted_prefix() >= 10 && view.sorted_prefix() < v.size());
+
+    size_t i = 0;
+    for (int x : view) assert(x == expected[i++]);
+    assert(i == v.size() && view.sorted_prefix() == v.size());
+    assert(v == expected);
+
+    // Beaucoup de doublons : le pivot échantillonné ne sépare rien
+    auto dup = random_ints(5000, 3);
+    auto dup_sorted = dup;
+    std::sort(dup_sorted.begin(), dup_sorted.end());
+    lazy_sorted_view dup_view(dup);
+    for (size_t k = 0; k < dup.size(); k += 97) assert(dup_view[k] == dup_sorted[k]);
+
+    std::vector<std::string> words = {"pear", "apple", "fig", "kiwi", "banana"};
+    lazy_sorted_view desc(words, [](const std::string& a, const std::string& b) { return a > b; });
+    assert(desc[0] == "pear" && desc[4] == "apple");
+    std::cout << "✓ Test lazy sorted view passed\n";
+}
+
+void test_loser_tree_merge() {
+    struct Item { int key; int tag; };
+    auto by_key = [](const Item& a, const Item& b) { return a.key < b.key; };
+    for (size_t k : {1, 2, 5, 37, 300}) {
+        std::vector<std::vector<Item>> runs(k);
+        std::vector<Item> all;
+        int tag = 0;
+        for (size_t r = 0; r < k; ++r) {
+            // Runs de longueurs variées (certains vides), clés peu nombreuses pour les égalités
+            auto keys = random_ints((r * 31) % 97, r % 3 ? 50 : 1000, static_cast<unsigned>(r + 1));
+            std::sort(keys.begin(), keys.end());
+            for (int key : keys) runs[r].push_back({key, tag++});
+            all.insert(all.end(), runs[r].begin(), runs[r].end());
+        }
+        std::vector<std::span<const Item>> spans(runs.begin(), runs.end());
+        std::vector<Item> merged(all.size());
+        LoserTreeMerger<Item, decltype(by_key)> merger(k, by_key);
+        auto end = merger.merge(spans, merged.begin());
+        assert(end == merged.end());
+        std::stable_sort(all.begin(), all.end(), by_key);
+        for (size_t i = 0; i < all.size(); ++i) assert(merged[i].key == all[i].key && merged[i].tag == all[i].tag);
+    }
+
+    // Longs runs ordonnés : chemin par blocs
+    std::vector<int> a(1000), b(1000), out;
+    std::iota(a.begin(), a.end(), 0);
+    std::iota(b.begin(), b.end(), 500);
+    std::vector<std::span<const int>> spans = {a, b};
+    kway_merge<int>(spans, std::back_inserter(out));
+    assert(out.size() == 2000 && std::is_sorted(out.begin(), out.end()));
+
+    // Tête, bloc de 16 puis un perdant (100 > 50), ou run terminé sur une frontière de bloc
+    for (size_t len : {18, 17, 33}) {
+        std::vector<int> head(len), one = {50};
+        std::iota(head.begin(), head.end(), 0);
+        if (len == 18) head.back() = 100;
+        std::vector<std::span<const int>> pair = {head, one};
+        std::vector<int> both(len + 1);
+        kway_merge<int>(pair, both.begin());
+        assert(std::is_sorted(both.begin(), both.end()));
+    }
+
+    // Rafales de valeurs consécutives entrelacées entre les runs, finissant sur une frontière de bloc
+    for (size_t k : {2, 3, 7}) {
+        for (size_t burst : {17, 20, 33}) {
+            std::vector<std::vector<int>> bursts(k);
+            for (size_t r = 0; r < k; ++r)
+                for (size_t i = 0; i < 321; ++i)
+                    bursts[r].push_back(static_cast<int>((i / burst * k + r) * burst + i % burst));
+            std::vector<std::span<const int>> runs(bursts.begin(), bursts.end());
+            std::vector<int> merged(321 * k), expected;
+            kway_merge<int>(runs, merged.begin());
+            for (auto& run : bursts) expected.insert(expected.end(), run.begin(), run.end());
+            std::sort(expected.begin(), expected.end());
+            assert(merged == expected);
+        }
+    }
+    std::cout << "✓ Test loser tree merge passed\n";
+}
+
+void test_radix_sort() {
+    auto ints = random_ints(3000, 1 << 30);
+    std::vector<std::uint64_t> packed(ints.size()), scratch(ints.size());
+    for (size_t i = 0; i < ints.size(); ++i) packed[i] = (std::uint64_t(ints[i] % 1000) << 32) | i;
+    radix_sort(std::span(packed), std::span(scratch), [](std::uint64_t v) { return std::uint32_t(v >> 32); });
+    // Stable : à clé égale, l'index (bits bas) reste croissant
+    assert(std::is_sorted(packed.begin(), packed.end()));
+
+    std::vector<std::uint32_t> plain(ints.begin(), ints.end()), tmp(plain.size());
+    auto expected = plain;
+    std::sort(expected.begin(), expected.end());
+    radix_sort(std::span(plain), std::span(tmp));
+    assert(plain == expected);
+    std::cout << "✓ Test radix sort passed\n";
+}
+
+void test_morton() {
+    static_assert(morton2d_32(3, 3) == 15 && morton2d_32(0, 1) == 2);
+    static_assert(morton3d_32(1, 1, 1) == 7 && morton3d_32(2, 0, 0) == 8);
+    static_assert(morton2d_64(0xFFFFFFFFu, 0) == 0x5555555555555555ull);
+    static_assert(morton3d_64(0x1FFFFF, 0, 0) == 0x1249249249249249ull);
+    // Chemin BMI2 (si disponible) contre la dilatation par constantes magiques
+    for (std::uint32_t v = 1; v < 100000; v = v * 3 + 1) {
+        const std::uint32_t a = v & 0xFFFF, b = (v >> 3) & 0xFFFF, c = v & 0x3FF;
+        assert(morton2d_32(a, b) == (detail::dilate2_32(a) | detail::dilate2_32(b) << 1));
+        assert(morton3d_32(c, c ^ 5, c >> 1) == (detail::dilate3_32(c) | detail::dilate3_32(c ^ 5) << 1 | detail::dilate3_32(c >> 1) << 2));
+        assert(morton3d_64(v, v >> 1, v >> 2) == (detail::dilate3_64(v) | detail::dilate3_64(v >> 1) << 1 | detail::dilate3_64(v >> 2) << 2));
+    }
+
+    for (size_t n : {10, 3000}) {
+        auto coords = random_ints(3 * n, 1000);
+        std::vector<std::array<float, 3>> points(n);
+        for (size_t i = 0; i < n; ++i) points[i] = {float(coords[3 * i]), float(coords[3 * i + 1]), float(coords[3 * i + 2]) * 0.5f};
+        std::vector<std::uint32_t> order(n), order64(n);
+        morton_order(points, order);
+        morton_order<std::uint64_t>(points, order64);
+
+        const auto encode = MortonEncoder<3>::fit(points);
+        const auto encode64 = MortonEncoder<3, std::uint64_t>::fit(points);
+        std::vector<bool> seen(n);
+        for (size_t i = 0; i < n; ++i) {
+            seen[order[i]] = true;
+            if (i > 0) {
+                const auto k0 = encode(points[order[i - 1]]), k1 = encode(points[order[i]]);
+                assert(k0 < k1 || (k0 == k1 && order[i - 1] < order[i]));
+                assert(encode64(points[order64[i - 1]]) <= encode64(points[order64[i]]));
+            }
+        }
+        assert(std::find(seen.begin(), seen.end(), false) == seen.end());
+    }
+    std::cout << "✓ Test morton passed\n";
+}
+
+void test_coo_to_csr() {
+    // Lignes courtes (réseaux), une ligne longue (hybrid_sort) et des doublons
+    const size_t rows = 300, cols = 50;
+    auto r = random_ints(4000, int(rows), 3), c = random_ints(4000, int(cols), 5);
+    for (size_t i = 0; i < 600; ++i) r[i] = 7;
+    std::vector<std::uint32_t> ri(r.begin(), r.end()), ci(c.begin(), c.end());
+    std::vector<double> v(ri.size());
+    std::iota(v.begin(), v.end(), 0.0);
+
+    std::vector<size_t> expected(ri.size());
+    std::iota(expected.begin(), expected.end(), 0);
+    std::stable_sort(expected.begin(), expected.end(), [&](size_t a, size_t b) {
+        return ri[a] != ri[b] ? ri[a] < ri[b] : ci[a] < ci[b];
+    });
+
+    WorkerPool pool(3);
+    for (WorkerPool* p : {static_cast<WorkerPool*>(nullptr), &pool}) {
+        const auto m = coo_to_csr<double>(rows, cols, ri, ci, v, p);
+        assert(m.row_ptr.size() == rows + 1 && m.row_ptr[rows] == ri.size());
+        for (size_t row = 0; row < rows; ++row)
+            for (size_t k = m.row_ptr[row]; k < m.row_ptr[row + 1]; ++k) assert(ri[expected[k]] == row);
+        for (size_t k = 0; k < ri.size(); ++k) {
+            assert(m.col_idx[k] == ci[expected[k]]);
+            assert(m.values[k] == v[expected[k]]);
+        }
+    }
+    std::cout << "✓ Test COO to CSR passed\n";
+}
+
+void test_batch_sort() {
+    auto ints = random_ints(8 * 100, 1000);
+    std::vector<float> data(ints.begin(), ints.end());
+    StaticBatchSort<8>()(data.data(), 100);  // 100 = 6 lots de 16 voies + 4 tableaux
+    for (size_t j = 0; j < 100; ++j) assert(std::is_sorted(data.begin() + 8 * j, data.begin() + 8 * (j + 1)));
+
+    std::vector<std::array<double, 13>> arrays(37);
+    for (size_t j = 0; j < arrays.size(); ++j)
+        for (size_t i = 0; i < 13; ++i) arrays[j][i] = double(ints[j * 13 % 700 + i]);
+    auto expected = arrays;
+    for (auto& a : expected) std::sort(a.begin(), a.end());
+    std::vector<double*> rows;
+    for (auto& a : arrays) rows.push_back(a.data());
+    StaticBatchSort<13>()(rows.data(), rows.size());
+    assert(arrays == expected);
+
+    // Mots de 32 bits, N multiple de 8 : transposition en registres par tuiles 8x8
+    std::vector<std::array<std::int32_t, 16>> windows(45);
+    for (size_t j = 0; j < windows.size(); ++j)
+        for (size_t i = 0; i < 16; ++i) windows[j][i] = ints[j * 16 + i] - 500;
+    auto sorted_windows = windows;
+    for (auto& a : sorted_windows) std::sort(a.begin(), a.end());
+    StaticBatchSort<16>()(std::span(windows));
+    assert(windows == sorted_windows);
+    std::cout << "✓ Test batch sort passed\n";
+}
+
+void test_sort_service() {
+    std::vector<std::array<int, 8>> arrays(4 * 300);
+    auto ints = random_ints(arrays.size() * 8, 1000);
+    for (size_t j = 0; j < arrays.size(); ++j) std::copy_n(ints.begin() + 8 * j, 8, arrays[j].begin());
+    std::atomic<int> callbacks{0};
+    {
+        SortService service(3, 64);
+        // Petites soumissions concurrentes (coalescées), futures et callbacks
+        std::vector<std::thread> producers;
+        for (size_t t = 0; t < 4; ++t)
+            producers.emplace_back([&, t] {
+                std::vector<std::future<void>> pending;
+                for (size_t j = t * 300; j < (t + 1) * 300;) {
+                    const size_t n = std::min<size_t>(1 + j % 3, (t + 1) * 300 - j);
+                    std::span<std::array<int, 8>> batch(arrays.data() + j, n);
+                    if (j % 2) service.submit(batch, [&] { ++callbacks; });
+                    else pending.push_back(service.submit(batch));
+                    j += n;
+                }
+                for (auto& f : pending) f.get();
+            });
+        for (auto& p : producers) p.join();
+
+        auto big = random_ints(20000, 1 << 20);
+        service.submit_range(std::span<int>(big)).get();
+        assert(std::is_sorted(big.begin(), big.end()));
+
+        std::vector<int> small = {3, 1, 2, 5, 4, 0, 9, 8, 7, 6, 11, 10, 13, 12, 15, 14, 17, 16};
+        auto f = service.submit_range(std::span<int>(small), [](int a, int b) {
+            if (a == 13 || b == 13) throw std::runtime_error("comparator");
+            return a < b;
+        });
+        bool thrown = false;
+        try { f.get(); } catch (const std::runtime_error&) { thrown = true; }
+        assert(thrown);
+    }  // le destructeur termine les callbacks en attente
+    for (const auto& a : arrays) assert(std::is_sorted(a.begin(), a.end()));
+    assert(callbacks > 0);
+    std::cout << "✓ Test sort service passed\n";
+}
+
+// Exécuteurs et coroutine minimale pour static_sort_async
+struct ThreadExecutor {
+    std::mutex mutex;
+    std::vector<std::thread> threads;
+    void execute(std::function<void()> task) {
+        std::lock_guard lock(mutex);
+        threads.emplace_back(std::move(task));
+    }
+    ~ThreadExecutor() { for (auto& t : threads) t.join(); }
+};
+
+struct InlineExecutor {
+    void execute(std::function<void()> task) { task(); }
+};
+
+struct DetachedTask {
+    struct promise_type {
+        DetachedTask get_return_object() { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+template<class Executor, class Compare = detail::DefaultLess>
+DetachedTask sort_then_signal(std::vector<int>& v, Executor& ex, std::promise<bool>& done, Compare c = {}) {
+    try {
+        co_await static_sort_async(v, ex, c, 4);
+        done.set_value(true);
+    } catch (const std::runtime_error&) {
+        done.set_value(false);
+    }
+}
+
+void test_sort_async() {
+    for (size_t n : {1000, 100000}) {
+        auto v = random_ints(n, 1 << 20);
+        auto expected = v;
+        std::sort(expected.begin(), expected.end());
+        {
+            ThreadExecutor ex;
+            std::promise<bool> done;
+            sort_then_signal(v, ex, done);
+            assert(done.get_future().get());
+        }
+        assert(v == expected);
+
+        auto w = random_ints(n, 1 << 20, 3);
+        expected = w;
+        std::sort(expected.begin(), expected.end(), std::greater<int>());
+        InlineExecutor inline_ex;
+        std::promise<bool> done;
+        sort_then_signal(w, inline_ex, done, std::greater<int>());
+        assert(done.get_future().get() && w == expected);
+    }
+
+    // Rafales de 33 valeurs consécutives mélangées : une tête puis deux blocs par rafale dans la fusion
+    auto order_key = random_ints(2500, 1 << 20, 5);
+    std::vector<int> order(2500), bursts;
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](int a, int b) { return order_key[a] < order_key[b]; });
+    for (int b : order)
+        for (int i = 0; i < 33; ++i) bursts.push_back(b * 33 + i);
+    {
+        ThreadExecutor ex;
+        std::promise<bool> done;
+        sort_then_signal(bursts, ex, done);
+        assert(done.get_future().get());
+    }
+    std::vector<int> expected(bursts.size());
+    std::iota(expected.begin(), expected.end(), 0);
+    assert(bursts == expected);
+
+    auto v = random_ints(100000, 1000);
+    ThreadExecutor ex;
+    std::promise<bool> done;
+    sort_then_signal(v, ex, done, [](int a, int b) {
+        if (a == 500) throw std::runtime_error("comparator");
+        return a < b;
+    });
+    assert(!done.get_future().get());
+    std::cout << "✓ Test sort async passed\n";
+}
+
+void test_selection_stats() {
+    // Principe 0-1 : toutes les entrées binaires de 12 éléments
+    for (unsigned bits = 0; bits < (1u << 12); ++bits) {
+        std::array<int, 12> a, b;
+        for (unsigned i = 0; i < 12; ++i) a[i] = b[i] = (bits >> i) & 1;
+        auto s = a;
+        std::sort(s.begin(), s.end());
+        StaticSelect<12, 2, 5, 6>()(a);
+        assert(a[2] == s[2] && a[5] == s[5] && a[6] == s[6]);
+        StaticPartialSort<12, 4>()(b);
+        assert(std::equal(b.begin(), b.begin() + 4, s.begin()));
+    }
+    static_assert(StaticSelect<25, 12>::comparators == 113);  // 154 pour le tri complet
+
+    // Statistiques par groupe contre un tri complet de chaque groupe ; 37 = lots complets + reste
+    auto ints = random_ints(9 * 37, 1000);
+    std::vector<double> v(ints.begin(), ints.end());
+    v[4] = 1e30;  // valeur aberrante, écartée par la moyenne tronquée
+    std::vector<double> med(37), mad(37), iqr(37), trimmed(37);
+    StaticGroupStats<9> stats;
+    stats.median(v.data(), 37, med.data());
+    stats.mad(v.data(), 37, mad.data());
+    stats.iqr(v.data(), 37, iqr.data());
+    stats.trimmed_mean<2>(v.data(), 37, trimmed.data());
+    for (size_t g = 0; g < 37; ++g) {
+        std::vector<double> s(v.begin() + 9 * g, v.begin() + 9 * (g + 1));
+        std::sort(s.begin(), s.end());
+        std::vector<double> dev;
+        for (double x : s) dev.push_back(std::abs(x - s[4]));
+        std::sort(dev.begin(), dev.end());
+        assert(med[g] == s[4]);
+        assert(mad[g] == dev[4]);
+        assert(iqr[g] == s[6] - s[2]);
+        assert(std::abs(trimmed[g] - (s[2] + s[3] + s[4] + s[5] + s[6]) / 5) < 1e-9);
+    }
+
+    std::vector<float> f = {4, 1, 3, 2, 10, 20, 40, 30};
+    float fmed[2], fiqr[2];
+    StaticGroupStats<4>().median(f.data(), 2, fmed);
+    StaticGroupStats<4>().iqr(f.data(), 2, fiqr);
+    assert(fmed[0] == 2.5f && fmed[1] == 25.0f);
+    assert(fiqr[0] == 1.5f && fiqr[1] == 15.0f);  // type 7 : 3.25 - 1.75, 32.5 - 17.5
+    std::cout << "✓ Test selection networks and group statistics passed\n";
+}
+
+void test_grouped_quantiles() {
+    // Groupes vides, courts (réseaux), moyens (tri) et longs (sélections)
+    std::vector<size_t> offsets = {0};
+    for (size_t len : {0, 1, 2, 9, 16, 17, 128, 129, 5000, 0, 3})
+        offsets.push_back(offsets.back() + len);
+    auto ints = random_ints(offsets.back(), 100000);
+    auto sorted = ints;
+    WorkerPool pool(3);
+    const std::array<double, 4> qs = {0.99, 0.5, 0.0, 0.9};
+    auto out = grouped_quantiles(std::span<int>(ints), std::span<const size_t>(offsets), qs, detail::DefaultLess{}, &pool);
+    assert(out.size() == (offsets.size() - 1) * qs.size());
+    segmented_sort(std::span<int>(sorted), std::span<const size_t>(offsets), detail::DefaultLess{}, &pool);
+    for (size_t g = 0; g + 1 < offsets.size(); ++g) {
+        const size_t n = offsets[g + 1] - offsets[g];
+        const int* s = sorted.data() + offsets[g];
+        assert(std::is_sorted(s, s + n));
+        for (size_t k = 0; k < qs.size(); ++k) {
+            const double got = out[g * qs.size() + k];
+            if (n == 0) { assert(std::isnan(got)); continue; }
+            const double h = qs[k] * double(n - 1);
+            const size_t lo = size_t(h);
+            const double expected = lo + 1 < n ? s[lo] + (h - double(lo)) * (s[lo + 1] - s[lo]) : s[lo];
+            assert(std::abs(got - expected) < 1e-6);
+        }
+    }
+
+    std::vector<float> f = {4, 1, 3, 2};
+    const size_t one[] = {0, 4};
+    auto med = grouped_quantiles(std::span<float>(f), std::span<const size_t>(one), {0.5});
+    assert(med.size() == 1 && med[0] == 2.5f);
+    std::cout << "✓ Test grouped quantiles passed\n";
+}
+
+void test_multi_merge() {
+    // 8 listes top-4 triées -> fusion complète, puis top-4 global seul
+    auto ints = random_ints(32 * 41, 1000);
+    std::vector<int> data(ints.begin(), ints.end());
+    for (size_t r = 0; r < data.size() / 4; ++r) std::sort(data.begin() + 4 * r, data.begin() + 4 * (r + 1));
+    auto expected = data;
+    for (size_t g = 0; g < 41; ++g) std::sort(expected.begin() + 32 * g, expected.begin() + 32 * (g + 1));
+
+    std::array<int, 32> one;
+    std::copy_n(data.begin(), 32, one.begin());
+    auto top = one;
+    StaticMultiMerge<8, 4>()(one);
+    assert(std::equal(one.begin(), one.end(), expected.begin()));
+    StaticMultiMerge<8, 4, 4>()(top.begin(), top.end());
+    assert(std::equal(top.begin(), top.begin() + 4, expected.begin()));
+    static_assert(StaticMultiMerge<8, 4, 4>::comparators < StaticMultiMerge<8, 4>::comparators);
+
+    StaticMultiMerge<8, 4>().batch(data.data(), 41);  // 41 = lots complets + reste scalaire
+    assert(data == expected);
+
+    const std::array<std::array<std::string, 3>, 2> runs = {{{"b", "d", "f"}, {"a", "c", "e"}}};
+    const auto merged = StaticMultiMerge<2, 3>().merge(runs);
+    assert(std::is_sorted(merged.begin(), merged.end()) && merged.front() == "a");
+    const auto desc = StaticMultiMerge<2, 3>().merge(std::array<std::array<int, 3>, 2>{{{9, 5, 1}, {8, 2, 0}}}, std::greater<>());
+    assert((desc == std::array<int, 6>{9, 8, 5, 2, 1, 0}));
+    std::cout << "✓ Test multi-way merge networks passed\n";
+}
+
+enum class Bucket : std::uint16_t { Low = 2, Mid, High, Peak };
+template<> struct sort_value_range<Bucket> : SortValueRange<Bucket::Low, Bucket::Peak> {};
+
+void test_counting_sort() {
+    // Domaine déclaré par le type : uint8_t et une énumération
+    auto ints = random_ints(256, 1 << 20);
+    std::array<std::uint8_t, 256> bytes;
+    for (size_t i = 0; i < bytes.size(); ++i) bytes[i] = std::uint8_t(ints[i]);
+    auto expected = bytes;
+    std::sort(expected.begin(), expected.end());
+    StaticSort<256>()(bytes);
+    assert(bytes == expected);
+
+    std::vector<Bucket> buckets(64);
+    for (size_t i = 0; i < buckets.size(); ++i) buckets[i] = Bucket(2 + ints[i] % 4);
+    StaticSort<64>()(buckets.begin(), buckets.end());
+    assert(std::is_sorted(buckets.begin(), buckets.end()));
+
+    // Domaine déclaré à l'appel ; 37 = vecteurs complets + reste scalaire
+    std::array<int, 37> small;
+    for (size_t i = 0; i < small.size(); ++i) small[i] = ints[i] % 12 - 6;
+    auto sorted_small = small;
+    std::sort(sorted_small.begin(), sorted_small.end());
+    StaticSort<37>()(small, SortValueRange<-6, 5>());
+    assert(small == sorted_small);
+
+    std::vector<std::int64_t> wide(20);
+    for (size_t i = 0; i < wide.size(); ++i) wide[i] = 1000 + ints[i] % 300;
+    StaticSort<20>()(wide, SortValueRange<std::int64_t(1000), std::int64_t(1299)>());
+    assert(std::is_sorted(wide.begin(), wide.end()));
+
+    constexpr auto at_compile_time = [] {
+        std::array<std::uint8_t, 64> a{};
+        for (int i = 0; i < 64; ++i) a[i] = std::uint8_t(64 - i);
+        StaticSort<64>()(a);  // évaluation constante : réseau
+        return a[0];
+    }();
+    static_assert(at_compile_time == 1);
+    static_assert(detail::AutoCounting<std::uint8_t, 64> && !detail::AutoCounting<std::uint8_t, 32>);
+    std::cout << "✓ Test counting sort passed\n";
+}
+
+void test_byte_keys() {
+    // Préfixes communs fréquents : la décision tombe sur tous les octets
+    auto ints = random_ints(32 * 64, 1 << 20);
+    auto check = [&]<size_t L>(std::array<std::array<std::byte, L>, 32> keys) {
+        for (size_t i = 0; i < keys.size(); ++i)
+            for (size_t j = 0; j < L; ++j) keys[i][j] = std::byte(ints[i * L + j] % 3 == 0 ? 0xF0 : 0x0F);
+        auto expected = keys;
+        std::sort(expected.begin(), expected.end(), [](const auto& a, const auto& b) {
+            return std::memcmp(a.data(), b.data(), L) < 0;
+        });
+        StaticSort<32>()(keys);
+        assert(keys == expected);
+    };
+    check(std::array<std::array<std::byte, 16>, 32>{});
+    check(std::array<std::array<std::byte, 32>, 32>{});
+    check(std::array<std::array<std::byte, 24>, 32>{});
+    check(std::array<std::array<std::byte, 64>, 32>{});
+
+    std::array<std::array<unsigned char, 8>, 3> uuids{{{9, 0, 0, 0, 0, 0, 0, 1}, {1, 0, 0, 0, 0, 0, 0, 9}, {1, 0, 0, 0, 0, 0, 0, 2}}};
+    StaticSort<3>()(uuids);
+    assert(uuids[0][7] == 2 && uuids[1][7] == 9 && uuids[2][0] == 9);
+    std::cout << "✓ Test byte keys passed\n";
+}
+
+void test_scratch_arena() {
+    // Ressource amont comptant les allocations : tout doit être servi par l'arène
+    struct Counting : std::pmr::memory_resource {
+        size_t calls = 0;
+        void* do_allocate(size_t bytes, size_t align) override { ++calls; return std::pmr::new_delete_resource()->allocate(bytes, align); }
+        void do_deallocate(void* p, size_t bytes, size_t align) override { std::pmr::new_delete_resource()->deallocate(p, bytes, align); }
+        bool do_is_equal(const std::pmr::memory_resource& o) const noexcept override { return this == &o; }
+    } upstream;
+    HugePageArena arena(1 << 20, &upstream);
+    assert(arena.capacity() == HugePageArena::kHugePage);
+
+    auto coords = random_ints(3 * 2000, 1000);
+    std::vector<std::array<float, 3>> points(2000);
+    for (size_t i = 0; i < points.size(); ++i) points[i] = {float(coords[3 * i]), float(coords[3 * i + 1]), float(coords[3 * i + 2])};
+    std::vector<std::uint32_t> order(points.size()), expected(points.size());
+    morton_order(points, expected);
+
+    std::vector<int> a(1000), b(1000), merged;
+    std::iota(a.begin(), a.end(), 0);
+    std::iota(b.begin(), b.end(), 500);
+    std::vector<std::span<const int>> runs = {a, b};
+    std::vector<double> column(points.size());
+    std::iota(column.begin(), column.end(), 0.0);
+    for (int repeat = 0; repeat < 3; ++repeat) {
+        morton_order(points, std::span(order), &arena);
+        assert(order == expected);
+        merged.clear();
+        kway_merge<int>(runs, std::back_inserter(merged), {}, &arena);
+        assert(std::is_sorted(merged.begin(), merged.end()));
+        PermutationApplier applier(points.size(), sizeof(double), nullptr, &arena);
+        applier.apply(order, std::span(column));
+        assert(arena.used() > 0);
+    }
+    // Tampons rendus dans l'ordre inverse : l'arène est vide, l'amont jamais sollicité
+    assert(arena.used() == 0 && upstream.calls == 0);
+
+    // Au-delà de la capacité : l'amont prend le relais
+    std::pmr::vector<std::byte> big(3 << 20, &arena);
+    assert(upstream.calls == 1);
+    std::cout << "✓ Test scratch arena passed\n";
+}
+
+void test_inplace_stable_sort() {
+    struct Rec { int key; int tag; };
+    auto by_key = [](const Rec& a, const Rec& b) { return a.key < b.key; };
+    // 20000 : fusions au-delà du tampon de pile (rotations) ; clés peu nombreuses pour les égalités
+    for (size_t n : {0, 1, 17, 1000, 20000}) {
+        auto keys = random_ints(n, 40, static_cast<unsigned>(n + 3));
+        std::vector<Rec> recs(n);
+        for (size_t i = 0; i < n; ++i) recs[i] = {keys[i], int(i)};
+        auto expected = recs;
+        std::stable_sort(expected.begin(), expected.end(), by_key);
+        inplace_stable_sort(recs.begin(), recs.end(), by_key);
+        for (size_t i = 0; i < n; ++i) assert(recs[i].key == expected[i].key && recs[i].tag == expected[i].tag);
+    }
+
+    // Réseau pour les blocs d'entiers ; comparateur explicite et type non trivial
+    auto values = random_ints(5000, 100000);
+    auto sorted_values = values;
+    std::sort(sorted_values.begin(), sorted_values.end(), std::greater<>());
+    inplace_stable_sort(values, std::greater<>());
+    assert(values == sorted_values);
+
+    std::vector<std::string> words;
+    for (int v : random_ints(3000, 500)) words.push_back(std::to_string(v));
+    auto sorted_words = words;
+    std::stable_sort(sorted_words.begin(), sorted_words.end());
+    inplace_stable_sort(words);
+    assert(words == sorted_words);
+
+    // -0.0 et +0.0 sont égaux mais distincts : l'ordre des signes doit survivre
+    std::vector<double> zeros;
+    for (int v : random_ints(1000, 6)) zeros.push_back(v < 2 ? (v ? 0.0 : -0.0) : double(v - 4));
+    auto sorted_zeros = zeros;
+    std::stable_sort(sorted_zeros.begin(), sorted_zeros.end());
+    inplace_stable_sort(zeros);
+    for (size_t i = 0; i < zeros.size(); ++i)
+        assert(zeros[i] == sorted_zeros[i] && std::signbit(zeros[i]) == std::signbit(sorted_zeros[i]));
+    std::cout << "✓ Test inplace stable sort passed\n";
+}
+
+void test_sort_by_pointee() {
+    struct Entity { double weight; int priority; short level; };
+    auto ints = random_ints(3000, 200);
+    std::vector<Entity> pool(ints.size());
+    for (size_t i = 0; i < pool.size(); ++i) pool[i] = {ints[i] * 0.5 - 50.0, ints[i] % 13 - 6, short(ints[i] % 7)};
+    // Petit (réseaux) et grand (radix), clés entières signées, flottantes et courtes
+    for (size_t n : {10, 3000}) {
+        std::vector<Entity*> ptrs;
+        for (size_t i = 0; i < n; ++i) ptrs.push_back(&pool[i]);
+        auto expected = ptrs;
+        std::stable_sort(expected.begin(), expected.end(), [](auto* a, auto* b) { return a->priority < b->priority; });
+        sort_by_pointee(ptrs, &Entity::priority);
+        assert(ptrs == expected);
+
+        std::stable_sort(expected.begin(), expected.end(), [](auto* a, auto* b) { return a->weight < b->weight; });
+        sort_by_pointee(std::span(ptrs), [](const Entity& e) { return e.weight; });
+        assert(ptrs == expected);
+
+        sort_by_pointee(ptrs, &Entity::level);
+        assert(std::is_sorted(ptrs.begin(), ptrs.end(), [](auto* a, auto* b) { return a->level < b->level; }));
+    }
+
+    // Pointeurs possédants, déplacés ; -0.0 avant +0.0, infinis aux bornes
+    std::vector<std::unique_ptr<float>> owned;
+    for (float f : {2.5f, -0.0f, INFINITY, 0.0f, -1e30f, -INFINITY, 1e-30f}) owned.push_back(std::make_unique<float>(f));
+    sort_by_pointee(owned, [](float f) { return f; });
+    assert(*owned.front() == -INFINITY && *owned.back() == INFINITY && std::signbit(*owned[2]) && !std::signbit(*owned[3]));
+    std::cout << "✓ Test sort by pointee passed\n";
+}
+
+void test_static_partition() {
+    // Pivot : registres entiers (37 = vecteurs + reste scalaire), flottants, pivot non représentable
+    auto ints = random_ints(64 * 20, 200);
+    for (size_t r = 0; r < 20; ++r) {
+        std::array<int, 37> a;
+        std::array<double, 64> d;
+        for (size_t i = 0; i < a.size(); ++i) a[i] = ints[r * 64 + i] - 100;
+        for (size_t i = 0; i < d.size(); ++i) d[i] = ints[r * 64 + i] * 0.5;
+        auto ea = a;
+        auto ed = d;
+        const auto ka = std::stable_partition(ea.begin(), ea.end(), [](int x) { return x < 7; }) - ea.begin();
+        const auto kd = std::stable_partition(ed.begin(), ed.end(), [](double x) { return x < 50.25; }) - ed.begin();
+        assert(StaticPartition<37>()(a, 7) == size_t(ka) && a == ea);
+        assert(StaticPartition<64>()(d.begin(), d.end(), 50.25) == size_t(kd) && d == ed);
+
+        std::array<std::uint32_t, 16> u;
+        for (size_t i = 0; i < u.size(); ++i) u[i] = std::uint32_t(ints[r * 64 + i]) << 24;
+        auto eu = u;
+        const auto ku = std::stable_partition(eu.begin(), eu.end(), [](std::uint32_t x) { return x < 100u << 24; }) - eu.begin();
+        assert(StaticPartition<16>()(u, 100u << 24) == size_t(ku) && u == eu);
+        std::array<int, 16> h;
+        for (size_t i = 0; i < h.size(); ++i) h[i] = ints[r * 64 + i];
+        assert(StaticPartition<16>()(h, 99.5) == size_t(std::count_if(h.begin(), h.end(), [](int x) { return x < 100; })));
+    }
+
+    // Prédicat, type non trivial, évaluation constante
+    std::vector<int> v{5, 1, 4, 2, 3};
+    assert(StaticPartition<5>()(v.begin(), v.end(), [](int x) { return x % 2 == 0; }) == 2 && v == std::vector<int>({4, 2, 5, 1, 3}));
+    std::array<std::string, 4> words{"b", "d", "a", "c"};
+    assert(StaticPartition<4>()(words, [](const std::string& w) { return w < "c"; }) == 2 && words[0] == "b" && words[1] == "a");
+    constexpr auto split = [] {
+        std::array<int, 6> a{6, 1, 5, 2, 4, 3};
+        return StaticPartition<6>()(a, 4) * 10 + a[2];
+    }();
+    static_assert(split == 33);
+    std::cout << "✓ Test static partition passed\n";
+}
+
+void test_segmented_topk() {
+    // Groupes vides, plus courts que K, réseaux partiels (<= 16), paquets de candidats (longs)
+    std::vector<size_t> offsets = {0};
+    for (size_t len : {0, 1, 4, 5, 11, 16, 17, 40, 3000, 0, 2})
+        offsets.push_back(offsets.back() + len);
+    auto ints = random_ints(offsets.back(), 500);
+    const std::vector<int> input = ints;
+    WorkerPool pool(3);
+    auto top = segmented_topk<4>(std::span<const int>(ints), std::span<const size_t>(offsets), detail::DefaultLess{}, &pool);
+    auto top10 = segmented_topk<10>(std::span<int>(ints), std::span<const size_t>(offsets), std::greater<>{});
+    assert(ints == input && top.size() == (offsets.size() - 1) * 4);
+    for (size_t g = 0; g + 1 < offsets.size(); ++g) {
+        std::vector<int> s(input.begin() + offsets[g], input.begin() + offsets[g + 1]);
+        std::sort(s.begin(), s.end());
+        for (size_t i = 0; i < std::min<size_t>(4, s.size()); ++i) assert(top[g * 4 + i] == s[i]);
+        for (size_t i = 0; i < std::min<size_t>(10, s.size()); ++i) assert(top10[g * 10 + i] == s[s.size() - 1 - i]);
+    }
+
+    // Doublons : chaque élément gardé au plus une fois
+    std::vector<std::pair<int, int>> recs;
+    for (int i = 0; i < 100; ++i) recs.push_back({i % 3 == 0 ? 1 : 5, i});
+    const size_t one[] = {0, recs.size()};
+    std::array<std::pair<int, int>, 8> best;
+    segmented_topk<8>(std::span<const std::pair<int, int>>(recs), std::span<const size_t>(one), std::span(best),
+                      [](const auto& a, const auto& b) { return a.first < b.first; });
+    std::set<int> ids;
+    for (const auto& r : best) { assert(r.first == 1 && r.second % 3 == 0); ids.insert(r.second); }
+    assert(ids.size() == best.size());
+    std::cout << "✓ Test segmented top-K passed\n";
+}
+
+void test_group_by() {
+    // Clé et valeur sur 4 octets (paires empaquetées) puis clés de 8 octets (paires (clé, ligne))
+    auto ints = random_ints(3000, 1000);
+    std::vector<std::int32_t> keys(ints.size());
+    std::vector<float> values(ints.size());
+    for (size_t i = 0; i < ints.size(); ++i) {
+        keys[i] = ints[i] % 37 - 18;
+        values[i] = float(ints[i]) * 0.25f - 100.f;
+    }
+    std::vector<std::int64_t> wide(keys.begin(), keys.end());
+    for (auto& k : wide) k *= std::int64_t(1) << 40;
+    auto g = group_by(keys, values);
+    auto w = group_by(wide, values);
+    assert(g.keys.size() == 37 && w.keys.size() == 37);
+    for (size_t j = 0; j < g.keys.size(); ++j) {
+        assert(g.keys[j] == int(j) - 18 && w.keys[j] == std::int64_t(g.keys[j]) << 40);
+        std::uint32_t count = 0;
+        float sum = 0.f, lo = 1e9f, hi = -1e9f;
+        for (size_t i = 0; i < keys.size(); ++i)
+            if (keys[i] == g.keys[j]) { ++count; sum += values[i]; lo = std::min(lo, values[i]); hi = std::max(hi, values[i]); }
+        assert(g.count[j] == count && g.min[j] == lo && g.max[j] == hi && std::abs(g.sum[j] - sum) < 1e-2f * count);
+        assert(w.count[j] == count && w.min[j] == lo && w.max[j] == hi && w.sum[j] == g.sum[j]);
+    }
+
+    // Petit lot (réseau), sommes entières sur 64 bits
+    const std::uint8_t small_keys[] = {3, 1, 3, 2, 1, 3};
+    const std::int32_t small_values[] = {2000000000, 5, 2000000000, -7, 6, -1};
+    auto s = group_by(std::span<const std::uint8_t>(small_keys), std::span<const std::int32_t>(small_values));
+    assert((s.keys == std::vector<std::uint8_t>{1, 2, 3}) && (s.count == std::vector<std::uint32_t>{2, 1, 3}));
+    assert(s.sum[0] == 11 && s.sum[1] == -7 && s.sum[2] == 3999999999LL && s.min[2] == -1 && s.max[0] == 6);
+    std::cout << "✓ Test group by passed\n";
+}
+
+void test_sort_encode() {
+    // Blocs complets et incomplets, écarts nuls (doublons), pleine largeur de 32 bits
+    for (size_t n : {0, 1, 7, 256, 300, 5000}) {
+        auto ints = random_ints(n, 1 << 20);
+        std::vector<std::uint32_t> ids(ints.begin(), ints.end());
+        if (n > 2) { ids[1] = ids[0]; ids[2] = 0xFFFFFFFFu; }
+        auto expected = ids;
+        std::sort(expected.begin(), expected.end());
+        auto encoded = sort_encode(std::span(ids));
+        assert(ids == expected && encoded.size() <= encoded_capacity(n) && decoded_size(encoded) == n);
+        assert(decode_sorted(encoded) == expected);
+    }
+
+    // Identifiants denses : 1 bit par écart, 8 mots par bloc plus l'en-tête
+    std::vector<std::uint32_t> dense(512);
+    std::iota(dense.begin(), dense.end(), 1000u);
+    std::vector<std::uint32_t> out(encoded_capacity(dense.size()));
+    assert(encode_sorted(dense, out) == 1 + 2 * (2 + 8) && out[1] == 1 && out[2] == 1000u);
+    std::vector<std::uint32_t> same(40, 7u);
+    assert(encode_sorted(same, out) == 3 && decode_sorted(std::span<const std::uint32_t>(out.data(), 3)) == same);
+    std::cout << "✓ Test sort and encode passed\n";
+}
+
+void test_concurrent_topk() {
+    // 4 producteurs, un lecteur concurrent, classement décroissant
+    struct Hit { float score; std::uint32_t id; };
+    auto better = [](const Hit& a, const Hit& b) { return a.score > b.score; };
+    auto ints = random_ints(4 * 3000, 1000000);
+    ConcurrentTopK<8, Hit, decltype(better)> topk(4, better);
+    std::atomic<bool> done{false};
+    std::thread reader([&] {
+        while (!done.load()) {
+            auto v = topk.top();
+            assert(v.size() <= 8 && std::is_sorted(v.begin(), v.end(), better));
+        }
+    });
+    std::vector<std::thread> producers;
+    for (std::uint32_t t = 0; t < 4; ++t)
+        producers.emplace_back([&, t] {
+            auto p = topk.producer();
+            for (std::uint32_t i = t * 3000; i < (t + 1) * 3000; ++i) p.push({float(ints[i]), i});
+        });
+    for (auto& p : producers) p.join();
+    done = true;
+    reader.join();
+    std::vector<int> expected(ints.begin(), ints.end());
+    std::sort(expected.begin(), expected.end(), std::greater<>());
+    auto top = topk.top();
+    assert(top.size() == 8);
+    for (size_t i = 0; i < top.size(); ++i) assert(top[i].score == float(expected[i]) && ints[top[i].id] == expected[i]);
+
+    // Moins de K valeurs, publication explicite, plus de producteurs que d'emplacements
+    ConcurrentTopK<4, int> small(1);
+    auto p = small.producer();
+    p.push(3);
+    p.push(1);
+    assert(small.top().empty());
+    p.flush();
+    assert((small.top() == std::vector<int>{1, 3}));
+    bool refused = false;
+    try { auto q = small.producer(); } catch (const std::length_error&) { refused = true; }
+    assert(refused);
+    std::cout << "✓ Test concurrent top-K passed\n";
+}
+
+template<QueuePolicy Policy>
+void check_priority_queue() {
+    // Suite aléatoire d'opérations comparée à une table (valeur -> clé)
+    StaticPriorityQueue<24, float, std::uint32_t, Policy> q;
+    std::map<std::uint32_t, float> ref;
+    auto ints = random_ints(4 * 4000, 50);
+    std::uint32_t next = 0;
+    for (size_t s = 0; s + 3 < ints.size(); s += 4) {
+        const int op = ints[s] % 8;
+        if (op < 3) {
+            const bool ok = q.push(float(ints[s + 1]), next);
+            assert(ok == (ref.size() < 24));
+            if (ok) ref[next] = float(ints[s + 1]);
+            ++next;
+        } else if (op < 6) {
+            if (ref.empty()) { assert(q.empty()); continue; }
+            auto [key, value] = q.pop_min();
+            float lowest = ref.begin()->second;
+            for (auto& [v, k] : ref) lowest = std::min(lowest, k);
+            assert(key == lowest && ref.count(value) && ref[value] == key);
+            ref.erase(value);
+        } else if (op < 7) {
+            if (ref.empty()) continue;
+            auto it = std::next(ref.begin(), ints[s + 1] % ref.size());
+            const float key = float(ints[s + 2]);
+            assert(q.decrease_key(it->first, key) == (key < it->second));
+            if (key < it->second) it->second = key;
+        } else {
+            std::vector<float> keys(ints[s + 1] % 20);
+            std::vector<std::uint32_t> values(keys.size());
+            for (size_t i = 0; i < keys.size(); ++i) { keys[i] = float(ints[s + 2] + int(i) % 7); values[i] = next++; }
+            const size_t pushed = q.bulk_push(keys, values);
+            assert(pushed == std::min(keys.size(), 24 - ref.size()));
+            for (size_t i = 0; i < pushed; ++i) ref[values[i]] = keys[i];
+        }
+        assert(q.size() == ref.size());
+    }
+    assert(!q.decrease_key(next, 0.0f));
+    q.clear();
+    assert(q.empty() && q.push(1.0f, 0) && q.top().second == 0);
+
+    // Clés infinies : jamais confondues avec les places libres
+    const float inf = std::numeric_limits<float>::infinity();
+    q.clear();
+    assert(q.push(inf, 7) && q.top() == std::make_pair(inf, 7u));
+    assert(q.push(-inf, 8) && q.push(1.0f, 9) && q.push(-inf, 10));
+    for (std::uint32_t v : {8u, 10u, 9u, 7u}) assert(q.pop_min().second == v);
+    assert(q.empty());
+}
+
+void test_static_priority_queue() {
+    check_priority_queue<QueuePolicy::Sorted>();
+    check_priority_queue<QueuePolicy::Unsorted>();
+
+    // Politique triée : à clé égale, l'ordre d'insertion, lots compris
+    StaticPriorityQueue<8, int, std::uint32_t, QueuePolicy::Sorted> fifo;
+    fifo.push(1, 0);
+    fifo.push(1, 1);
+    const int keys[] = {1, 1};
+    const std::uint32_t values[] = {2, 3};
+    fifo.bulk_push(keys, values);
+    fifo.push(1, 4);
+    for (std::uint32_t i = 0; i < 5; ++i) assert(fifo.pop_min().second == i);
+    std::cout << "✓ Test static priority queue passed\n";
+}
+
+#if defined(STATIC_SORT_KERNELS)
+void test_kernels() {
+    auto ints = random_ints(32 * 10, 1000);
+    std::vector<double> d(ints.begin(), ints.end());
+    std::array<double, 8> a;
+    std::copy_n(d.begin(), 8, a.begin());
+    sort_kernel(a);
+    assert(std::is_sorted(a.begin(), a.end()));
+
+    ss_sort_f64_n32_batch(d.data(), 10);
+    for (size_t i = 0; i < 10; ++i) assert(std::is_sorted(d.begin() + 32 * i, d.begin() + 32 * (i + 1)));
+
+    std::vector<std::int32_t> v(ints.begin(), ints.begin() + 17);
+    ss_sort_i32_n17(v.data());
+    assert(std::is_sorted(v.begin(), v.end()));
+    std::vector<std::uint64_t> u(ints.begin(), ints.end());
+    ss_sort_u64(u.data(), u.size());
+    assert(std::is_sorted(u.begin(), u.end()));
+    std::cout << "✓ Test precompiled kernels passed\n";
+}
+#endif
+
 int main() {
     std::cout << "Running StaticSort correctness tests...\n";
     std::cout << "=======================================\n\n";
@@ -107,6 +1095,34 @@ int main() {
     test_timsort_sorted();
     test_timsort_reversed();
     test_all_sizes();
+    test_strided();
+    test_permutation_apply();
+    test_hybrid_sort();
+    test_lazy_sorted_view();
+    test_loser_tree_merge();
+    test_radix_sort();
+    test_morton();
+    test_coo_to_csr();
+    test_batch_sort();
+    test_sort_service();
+    test_sort_async();
+    test_selection_stats();
+    test_grouped_quantiles();
+    test_multi_merge();
+    test_counting_sort();
+    test_byte_keys();
+    test_scratch_arena();
+    test_inplace_stable_sort();
+    test_sort_by_pointee();
+    test_static_partition();
+    test_segmented_topk();
+    test_group_by();
+    test_sort_encode();
+    test_concurrent_topk();
+    test_static_priority_queue();
+#if defined(STATIC_SORT_KERNELS)
+    test_kernels();
+#endif
 
     std::cout << "\n=======================================\n";
     std::cout << "✅ All tests passed successfully!\n";